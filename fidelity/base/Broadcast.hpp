@@ -0,0 +1,314 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Loop.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+template <typename MessageT>
+class BroadcastSubscriber;
+
+/**
+ * Broadcast topic for one to many communication between running loops.
+ * The topic is subscribed to a publisher like a normal subscriber, but stores each message only
+ * once in a single ring buffer. All broadcast subscribers read from this ring with their own read
+ * cursor, so write time and memory do not grow with the number of readers.
+ *
+ * Readers which are slower than the publisher are handled by the configured SlowReader behavior:
+ * either the publisher overwrites the oldest messages and the slow reader skips them, or writes are
+ * rejected until the slowest reader has freed a slot.
+ *
+ * Only one publisher may write to a topic. Messages need to be trivially copyable, because readers
+ * validate their copy with a sequence lock instead of locking the slot.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class BroadcastTopic : public ISubscriber<MessageT> {
+  static_assert(std::is_trivially_copyable<MessageT>::value,
+                "Broadcast messages need to be trivially copyable.");
+
+ public:
+  /** Behavior of publisher, if a reader did not read the oldest message yet. */
+  enum class SlowReader {
+    /** Overwrite oldest message, slow reader misses it. */
+    OVERWRITE,
+    /** Reject write, publisher misses the new message. */
+    REJECT
+  };
+
+  /**
+   * Create broadcast topic.
+   * @param name Name of topic, used for subscription to the publisher.
+   * @param capacity Capacity of ring buffer shared by all readers.
+   * @param slow_reader Behavior on writes, if a reader is a whole ring behind.
+   */
+  BroadcastTopic(const std::string& name, size_t capacity,
+                 SlowReader slow_reader = SlowReader::OVERWRITE);
+
+  ~BroadcastTopic() override = default;
+
+  BroadcastTopic(const BroadcastTopic&) = delete;
+  BroadcastTopic(BroadcastTopic&&) = delete;
+  BroadcastTopic& operator=(BroadcastTopic&&) = delete;
+  BroadcastTopic& operator=(const BroadcastTopic&) = delete;
+
+  /**
+   * Get name of topic.
+   * @return name Name of topic.
+   */
+  const std::string& getName() const override {
+    return m_name;
+  }
+
+  /**
+   * Register new reader to the topic.
+   * The reader will receive all messages written after subscription. Name of new reader needs to be
+   * unique for the topic.
+   * @param subscriber Reader which will be added.
+   * @return true on success, false otherwise.
+   */
+  bool subscribe(std::shared_ptr<BroadcastSubscriber<MessageT>> subscriber);
+
+  /**
+   * Write message once into the ring buffer and wake all readers.
+   * Write is lock free and must only be called by one publisher.
+   * @param message Message data to be written.
+   * @return true if data could be written.
+   */
+  bool write(const MessageT& message) override;
+
+  /**
+   * Write batch of messages into the ring buffer and wake all readers once.
+   * The write position is published once for the whole batch.
+   * @param messages Messages to be written.
+   * @param size Number of messages.
+   * @return Number of written messages, less than size if slow readers are rejected.
+   */
+  size_t write(const MessageT* messages, size_t size) override;
+
+  /** Messages are trivially copyable, so moved messages are copied. */
+  using ISubscriber<MessageT>::write;
+
+ private:
+  friend class BroadcastSubscriber<MessageT>;
+
+  /** Ring buffer slot, sequence is odd while slot is written. */
+  struct Slot {
+    std::atomic<uint64_t> sequence{0};
+    MessageT message{};
+  };
+
+  /** Read message at cursor position, see BroadcastSubscriber::read. */
+  bool read(std::atomic<uint64_t>& cursor, size_t& missed, MessageT& message) const;
+
+  /** Name of topic. */
+  const std::string m_name{};
+
+  /** Capacity of ring buffer. */
+  const size_t m_capacity{0};
+
+  /** Behavior on slow readers. */
+  const SlowReader m_slow_reader{SlowReader::OVERWRITE};
+
+  /** Ring buffer slots. */
+  std::unique_ptr<Slot[]> m_slots{};
+
+  /** Number of written messages, position of next write. */
+  alignas(64) std::atomic<uint64_t> m_head{0};
+
+  /** All registered readers. */
+  std::vector<std::shared_ptr<BroadcastSubscriber<MessageT>>> m_subscribers{};
+};
+
+/**
+ * Reading part of a broadcast topic.
+ * A broadcast subscriber keeps only a read cursor into the ring buffer of its topic.
+ * Reading is lock free and must only be done by one loop.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class BroadcastSubscriber {
+ public:
+  /**
+   * Create named broadcast subscriber.
+   * If a loop reference is passed, this loop will be woken up on each data update.
+   * @param name Name of subscriber.
+   * @param loop Loop or WaitSet trigger which will be woken up on each data update if wanted.
+   */
+  explicit BroadcastSubscriber(const std::string& name, IWakeable* const loop = nullptr);
+
+  /**
+   * Get name of subscriber.
+   * @return name Name of subscriber.
+   */
+  const std::string& getName() const {
+    return m_name;
+  }
+
+  /**
+   * Read next message of topic into an output variable.
+   * @param message Contains read data, if new data was received.
+   * @return true if new data was successfully read, false if no data was received.
+   */
+  bool read(MessageT& message);
+
+  /**
+   * Get number of messages, which were overwritten before they could be read.
+   * @return Number of missed messages.
+   */
+  size_t getMissed() const {
+    return m_missed;
+  }
+
+ private:
+  friend class BroadcastTopic<MessageT>;
+
+  /** Name of subscriber. */
+  const std::string m_name{};
+
+  /** Loop to be woken up on each data write. */
+  IWakeable* const m_loop{};
+
+  /** Topic the subscriber is registered to. */
+  const BroadcastTopic<MessageT>* m_topic{nullptr};
+
+  /** Position of next read, checked by publisher on rejecting slow readers. */
+  alignas(64) std::atomic<uint64_t> m_cursor{0};
+
+  /** Number of missed messages. */
+  size_t m_missed{0};
+};
+
+template <typename MessageT>
+BroadcastTopic<MessageT>::BroadcastTopic(const std::string& name, size_t capacity,
+                                         SlowReader slow_reader)
+    : m_name(name),
+      m_capacity(capacity),
+      m_slow_reader(slow_reader),
+      m_slots(std::make_unique<Slot[]>(capacity)) {
+  EXPECT(!name.empty(), "Topic needs to be named.");
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+}
+
+template <typename MessageT>
+bool BroadcastTopic<MessageT>::subscribe(
+    std::shared_ptr<BroadcastSubscriber<MessageT>> subscriber) {
+  if (subscriber == nullptr || subscriber->m_topic != nullptr) {
+    return false;
+  }
+
+  auto found_subscriber =
+      std::find_if(m_subscribers.begin(), m_subscribers.end(),
+                   [&](const std::shared_ptr<BroadcastSubscriber<MessageT>>& subscriber_it) {
+                     return subscriber_it->getName() == subscriber->getName();
+                   });
+
+  // subscriber already added
+  if (found_subscriber != m_subscribers.end()) {
+    return false;
+  }
+
+  subscriber->m_cursor.store(m_head.load(std::memory_order_acquire), std::memory_order_release);
+  subscriber->m_topic = this;
+  m_subscribers.push_back(subscriber);
+
+  return true;
+}
+
+template <typename MessageT>
+bool BroadcastTopic<MessageT>::write(const MessageT& message) {
+  return write(&message, 1) == 1;
+}
+
+template <typename MessageT>
+size_t BroadcastTopic<MessageT>::write(const MessageT* messages, size_t size) {
+  const uint64_t head = m_head.load(std::memory_order_relaxed);
+
+  size_t count = size;
+  if (m_slow_reader == SlowReader::REJECT) {
+    for (auto& subscriber : m_subscribers) {
+      const uint64_t used = head - subscriber->m_cursor.load(std::memory_order_acquire);
+      count = std::min<size_t>(count, m_capacity - used);
+    }
+  }
+
+  for (size_t index = 0; index < count; ++index) {
+    // sequence lock: odd sequence marks slot as being written
+    const uint64_t position = head + index;
+    Slot& slot = m_slots[position % m_capacity];
+    slot.sequence.store(2 * position + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.message = messages[index];  // NOLINT
+    slot.sequence.store(2 * position + 2, std::memory_order_release);
+  }
+  if (count == 0) {
+    return 0;
+  }
+  m_head.store(head + count, std::memory_order_release);
+
+  for (auto& subscriber : m_subscribers) {
+    if (subscriber->m_loop != nullptr) {
+      subscriber->m_loop->wake();
+    }
+  }
+  return count;
+}
+
+template <typename MessageT>
+bool BroadcastTopic<MessageT>::read(std::atomic<uint64_t>& cursor, size_t& missed,
+                                    MessageT& message) const {
+  uint64_t position = cursor.load(std::memory_order_relaxed);
+  while (true) {
+    const uint64_t head = m_head.load(std::memory_order_acquire);
+    if (position == head) {
+      cursor.store(position, std::memory_order_release);
+      return false;
+    }
+    // skip messages, which are already overwritten
+    if (head - position > m_capacity) {
+      missed += head - m_capacity - position;
+      position = head - m_capacity;
+    }
+
+    const Slot& slot = m_slots[position % m_capacity];
+    const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+    if (sequence == 2 * position + 2) {
+      message = slot.message;
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (slot.sequence.load(std::memory_order_relaxed) == sequence) {
+        cursor.store(position + 1, std::memory_order_release);
+        return true;
+      }
+    }
+    // slot overwritten while reading
+    ++missed;
+    ++position;
+  }
+}
+
+template <typename MessageT>
+BroadcastSubscriber<MessageT>::BroadcastSubscriber(const std::string& name, IWakeable* const loop)
+    : m_name(name), m_loop(loop) {
+  EXPECT(!name.empty(), "Subscriber needs to be named.");
+}
+
+template <typename MessageT>
+bool BroadcastSubscriber<MessageT>::read(MessageT& message) {
+  if (m_topic == nullptr) {
+    return false;
+  }
+  return m_topic->read(m_cursor, m_missed, message);
+}
+
+}  // namespace fdl
@@ -0,0 +1,125 @@
+#include "Copy.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#endif
+
+namespace fdl::copy {
+
+namespace {
+
+using CopyFunction = void (*)(void*, const void*, size_t);
+
+/** Minimal size of non temporal copies, 0 if disabled. */
+std::atomic<size_t> non_temporal_size{0};
+
+void copyMemory(void* destination, const void* source, size_t size) {
+  std::memcpy(destination, source, size);
+}
+
+#if defined(__x86_64__) || defined(__i386__)
+
+/** Stream blocks of 128 bytes to 32 byte aligned destination, returns number of copied bytes. */
+__attribute__((target("avx2"))) size_t streamBlocksAvx2(char* destination, const char* source,
+                                                        size_t size) {
+  size_t offset = 0;
+  for (; offset + 128 <= size; offset += 128) {
+    const auto* in = reinterpret_cast<const __m256i*>(source + offset);  // NOLINT
+    auto* out = reinterpret_cast<__m256i*>(destination + offset);        // NOLINT
+    const __m256i block0 = _mm256_loadu_si256(in);
+    const __m256i block1 = _mm256_loadu_si256(in + 1);
+    const __m256i block2 = _mm256_loadu_si256(in + 2);
+    const __m256i block3 = _mm256_loadu_si256(in + 3);
+    _mm256_stream_si256(out, block0);
+    _mm256_stream_si256(out + 1, block1);
+    _mm256_stream_si256(out + 2, block2);
+    _mm256_stream_si256(out + 3, block3);
+  }
+  return offset;
+}
+
+/** Stream blocks of 64 bytes to 16 byte aligned destination, returns number of copied bytes. */
+__attribute__((target("sse2"))) size_t streamBlocksSse2(char* destination, const char* source,
+                                                        size_t size) {
+  size_t offset = 0;
+  for (; offset + 64 <= size; offset += 64) {
+    const auto* in = reinterpret_cast<const __m128i*>(source + offset);  // NOLINT
+    auto* out = reinterpret_cast<__m128i*>(destination + offset);        // NOLINT
+    const __m128i block0 = _mm_loadu_si128(in);
+    const __m128i block1 = _mm_loadu_si128(in + 1);
+    const __m128i block2 = _mm_loadu_si128(in + 2);
+    const __m128i block3 = _mm_loadu_si128(in + 3);
+    _mm_stream_si128(out, block0);
+    _mm_stream_si128(out + 1, block1);
+    _mm_stream_si128(out + 2, block2);
+    _mm_stream_si128(out + 3, block3);
+  }
+  return offset;
+}
+
+/**
+ * Copy unaligned head with memcpy until destination is aligned, body with non temporal stores and
+ * the remaining tail with memcpy again.
+ */
+template <size_t Alignment, size_t (*StreamBlocks)(char*, const char*, size_t)>
+void streamAligned(void* destination, const void* source, size_t size) {
+  auto* out = static_cast<char*>(destination);
+  const auto* in = static_cast<const char*>(source);
+  const size_t head = (Alignment - reinterpret_cast<uintptr_t>(out) % Alignment) % Alignment;
+  if (size < head + BULK_SIZE) {
+    std::memcpy(out, in, size);
+    return;
+  }
+  std::memcpy(out, in, head);
+  size_t offset = head;
+  offset += StreamBlocks(out + offset, in + offset, size - offset);
+  // order non temporal stores before the following release of the queue position
+  _mm_sfence();
+  std::memcpy(out + offset, in + offset, size - offset);
+}
+
+CopyFunction select() {
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx2")) {
+    return streamAligned<32, streamBlocksAvx2>;
+  }
+  if (__builtin_cpu_supports("sse2")) {
+    return streamAligned<16, streamBlocksSse2>;
+  }
+  return copyMemory;
+}
+
+#else
+
+CopyFunction select() {
+  return copyMemory;
+}
+
+#endif
+
+}  // namespace
+
+void setNonTemporalSize(size_t size) {
+  non_temporal_size.store(size, std::memory_order_relaxed);
+}
+
+size_t getNonTemporalSize() {
+  return non_temporal_size.load(std::memory_order_relaxed);
+}
+
+void copy(void* destination, const void* source, size_t size) {
+  const size_t threshold = non_temporal_size.load(std::memory_order_relaxed);
+  if (threshold == 0 || size < threshold) {
+    std::memcpy(destination, source, size);
+    return;
+  }
+  // selected on first use, so copies during static initialization are safe
+  static const CopyFunction stream = select();
+  stream(destination, source, size);
+}
+
+}  // namespace fdl::copy
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace fdl::copy {
+
+/**
+ * Bulk copies of large trivially copyable messages.
+ * Copies are done by memcpy, which glibc already dispatches at runtime to the widest vector
+ * instructions of the cpu and which is at least as fast as own AVX2/SSE2 block copies for frames
+ * up to 64 KiB (see queue benchmark). Copies from a configurable size on use non temporal stores
+ * (AVX2 or SSE2, detected once at runtime), which bypass the cache, so writing big frames into a
+ * queue does not evict the working set of the writing thread. Whether this pays off depends on the
+ * cache size and the working set, so non temporal stores are disabled by default.
+ */
+
+/** Minimal size of trivially copyable messages, which are copied with copy(). */
+constexpr size_t BULK_SIZE = 1024;
+
+/**
+ * Set minimal size of copies, which use non temporal stores.
+ * Copies are not synchronized with the setting, so it should be set before queues are written.
+ * @param size Minimal size in Byte, 0 disables non temporal stores.
+ */
+void setNonTemporalSize(size_t size);
+
+/**
+ * Get minimal size of copies, which use non temporal stores.
+ * @return Minimal size in Byte, 0 if non temporal stores are disabled.
+ */
+size_t getNonTemporalSize();
+
+/**
+ * Copy size bytes from source to destination, memory areas must not overlap.
+ * @param destination Destination memory.
+ * @param source Source memory.
+ * @param size Number of bytes to copy.
+ */
+void copy(void* destination, const void* source, size_t size);
+
+/**
+ * Construct message at destination.
+ * Copies of large trivially copyable messages are done with copy(), all other messages are
+ * constructed by placement new.
+ * @tparam MessageT Type of pubsub message.
+ * @tparam ArgsT Types of message constructor arguments.
+ * @param destination Uninitialized storage for message.
+ * @param args Message constructor arguments.
+ */
+template <typename MessageT, typename... ArgsT>
+void construct(MessageT* destination, ArgsT&&... args) {
+  if constexpr (sizeof...(ArgsT) == 1 && std::is_trivially_copyable_v<MessageT> &&
+                sizeof(MessageT) >= BULK_SIZE &&
+                (std::is_same_v<std::decay_t<ArgsT>, MessageT> && ...)) {
+    copy(destination, &args..., sizeof(MessageT));
+  } else {
+    new (destination) MessageT(std::forward<ArgsT>(args)...);  // NOLINT
+  }
+}
+
+}  // namespace fdl::copy
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <functional>
+#include <string>
+#include <utility>
+
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Subscriber for publisher and reader running in the same thread, e.g. stages of one loop.
+ * Messages are passed by a direct call of a callback from the publisher's write, without queue,
+ * atomics or loop wake up. The callback runs in the publishing thread, so the subscriber must only
+ * be used if publisher and reader share a thread (see TopicRegistry::directSubscriber()).
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class DirectSubscriber : public ISubscriber<MessageT> {
+ public:
+  /** Callback called for each written message. */
+  using Callback = std::function<void(const MessageT&)>;
+
+  /**
+   * Create named subscriber.
+   * @param name Name of subscriber.
+   * @param callback Callback called for each written message.
+   */
+  DirectSubscriber(const std::string& name, Callback callback);
+
+  ~DirectSubscriber() override = default;
+
+  /**
+   * Get name of subscriber.
+   * @return name Name of subscriber.
+   */
+  const std::string& getName() const override {
+    return m_name;
+  }
+
+  /**
+   * Pass message to callback.
+   * @param message Message data to be passed.
+   * @return Always true.
+   */
+  bool write(const MessageT& message) override {
+    m_callback(message);
+    return true;
+  }
+
+  /**
+   * Pass batch of messages to callback, one call per message.
+   * @param messages Messages to be passed.
+   * @param size Number of messages.
+   * @return Always size.
+   */
+  size_t write(const MessageT* messages, size_t size) override {
+    for (size_t index = 0; index < size; ++index) {
+      m_callback(messages[index]);  // NOLINT
+    }
+    return size;
+  }
+
+  /** Messages are passed by reference, so moved messages aren't copied either. */
+  using ISubscriber<MessageT>::write;
+
+ private:
+  /** Name of subscriber. */
+  const std::string m_name{};
+
+  /** Callback called for each written message. */
+  Callback m_callback;
+};
+
+template <typename MessageT>
+DirectSubscriber<MessageT>::DirectSubscriber(const std::string& name, Callback callback)
+    : m_name(name), m_callback(std::move(callback)) {
+  EXPECT(!name.empty(), "Subscriber needs to be named.");
+  EXPECT(m_callback != nullptr, "Callback needs to be set.");
+}
+
+}  // namespace fdl
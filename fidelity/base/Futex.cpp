@@ -0,0 +1,57 @@
+#include "Futex.hpp"
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <ctime>
+
+namespace fdl::futex {
+
+namespace {
+
+long futex(std::atomic<uint32_t>& word, int op, bool shared, uint32_t value,
+           const timespec* timeout, uint32_t bitset = 0) {
+  if (!shared) {
+    op |= FUTEX_PRIVATE_FLAG;
+  }
+  return syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), op, value,  // NOLINT
+                 timeout, nullptr, bitset);
+}
+
+}  // namespace
+
+void wait(std::atomic<uint32_t>& word, uint32_t expected, bool shared) {
+  futex(word, FUTEX_WAIT, shared, expected, nullptr);
+}
+
+bool waitFor(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout,
+             bool shared) {
+  if (timeout <= std::chrono::nanoseconds::zero()) {
+    return word.load(std::memory_order_relaxed) != expected;
+  }
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  const timespec relative{static_cast<time_t>(seconds.count()),
+                          static_cast<long>((timeout - seconds).count())};
+  return futex(word, FUTEX_WAIT, shared, expected, &relative) == 0 || errno != ETIMEDOUT;
+}
+
+bool waitUntil(std::atomic<uint32_t>& word, uint32_t expected,
+               std::chrono::steady_clock::time_point deadline, bool shared) {
+  // steady_clock is based on CLOCK_MONOTONIC, which is the default clock of FUTEX_WAIT_BITSET
+  const auto time = deadline.time_since_epoch();
+  const auto seconds = std::chrono::duration_cast<std::chrono::seconds>(time);
+  const timespec absolute{static_cast<time_t>(seconds.count()),
+                          static_cast<long>(
+                              std::chrono::duration_cast<std::chrono::nanoseconds>(time - seconds)
+                                  .count())};
+  return futex(word, FUTEX_WAIT_BITSET, shared, expected, &absolute, FUTEX_BITSET_MATCH_ANY) == 0 ||
+         errno != ETIMEDOUT;
+}
+
+int wake(std::atomic<uint32_t>& word, int count, bool shared) {
+  return static_cast<int>(futex(word, FUTEX_WAKE, shared, static_cast<uint32_t>(count), nullptr));
+}
+
+}  // namespace fdl::futex
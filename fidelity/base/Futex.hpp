@@ -0,0 +1,62 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace fdl::futex {
+
+/**
+ * Thin wrappers of the linux futex system call.
+ * A futex lets a thread sleep until the value of a 32 bit word changes, without any system call
+ * on the fast path: waker and waiter only enter the kernel if somebody actually needs to sleep or
+ * to be woken. Shared futexes work across processes on words placed in shared memory, private
+ * futexes are faster but only work within a process.
+ */
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex word needs 32 bits.");
+static_assert(std::atomic<uint32_t>::is_always_lock_free, "Futex word needs to be lock free.");
+
+/**
+ * Sleep while word contains expected value until woken by wake().
+ * Returns immediately if word does not contain expected value. May return spuriously.
+ * @param word Futex word.
+ * @param expected Value of word, which lets the caller sleep.
+ * @param shared true if word is placed in memory shared between processes.
+ */
+void wait(std::atomic<uint32_t>& word, uint32_t expected, bool shared = false);
+
+/**
+ * Sleep while word contains expected value until woken by wake() or timeout elapsed.
+ * @param word Futex word.
+ * @param expected Value of word, which lets the caller sleep.
+ * @param timeout Maximal duration to sleep.
+ * @param shared true if word is placed in memory shared between processes.
+ * @return false if timeout elapsed, true otherwise.
+ */
+bool waitFor(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::nanoseconds timeout,
+             bool shared = false);
+
+/**
+ * Sleep while word contains expected value until woken by wake() or deadline is reached.
+ * The deadline is absolute on CLOCK_MONOTONIC (FUTEX_WAIT_BITSET), so repeated waits for the same
+ * deadline don't accumulate drift.
+ * @param word Futex word.
+ * @param expected Value of word, which lets the caller sleep.
+ * @param deadline Point in time to stop sleeping.
+ * @param shared true if word is placed in memory shared between processes.
+ * @return false if deadline was reached, true otherwise.
+ */
+bool waitUntil(std::atomic<uint32_t>& word, uint32_t expected,
+               std::chrono::steady_clock::time_point deadline, bool shared = false);
+
+/**
+ * Wake threads sleeping on word.
+ * @param word Futex word.
+ * @param count Maximal number of threads to wake.
+ * @param shared true if word is placed in memory shared between processes.
+ * @return Number of woken threads.
+ */
+int wake(std::atomic<uint32_t>& word, int count, bool shared = false);
+
+}  // namespace fdl::futex
@@ -0,0 +1,47 @@
+#include "LatencyHistogram.hpp"
+
+#include <contract/contract_assert.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+namespace fdl {
+
+std::chrono::nanoseconds LatencyHistogram::getPercentile(double percentile) const {
+  EXPECT(percentile >= 0.0 && percentile <= 100.0, "Percentile needs to be between 0 and 100.");
+  const uint64_t count = getCount();
+  if (count == 0) {
+    return std::chrono::nanoseconds(0);
+  }
+  const auto target =
+      std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile / 100.0 * count)));
+  uint64_t accumulated = 0;
+  for (size_t index = 0; index < BUCKETS; ++index) {
+    accumulated += m_buckets[index].load(std::memory_order_relaxed);
+    if (accumulated >= target) {
+      const uint64_t bound = std::min(upperBound(index), m_max.load(std::memory_order_relaxed));
+      return std::chrono::nanoseconds(bound);
+    }
+  }
+  return getMax();
+}
+
+void LatencyHistogram::reset() {
+  for (auto& bucket : m_buckets) {
+    bucket.store(0, std::memory_order_relaxed);
+  }
+  m_count.store(0, std::memory_order_relaxed);
+  m_max.store(0, std::memory_order_relaxed);
+}
+
+uint64_t LatencyHistogram::upperBound(size_t index) {
+  if (index < SUB_BUCKETS) {
+    return index;
+  }
+  const uint64_t sub_index = index - SUB_BUCKETS;
+  const uint64_t shift = sub_index / HALF_SUB_BUCKETS + 1;
+  const uint64_t top = sub_index % HALF_SUB_BUCKETS + HALF_SUB_BUCKETS;
+  return ((top + 1) << shift) - 1;
+}
+
+}  // namespace fdl
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace fdl {
+
+/**
+ * Lock free histogram of latencies with logarithmic buckets, each split into linear sub buckets
+ * (like HdrHistogram). Latencies below 64 ns are recorded exactly, larger latencies with a
+ * relative precision of about 3 %. Recording neither locks nor allocates memory, so it can be done
+ * by realtime threads while non realtime threads export percentiles.
+ */
+class LatencyHistogram {
+ public:
+  LatencyHistogram() = default;
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram(LatencyHistogram&&) = delete;
+  LatencyHistogram& operator=(LatencyHistogram&&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+  ~LatencyHistogram() = default;
+
+  /**
+   * Record a latency, negative latencies are recorded as 0.
+   * @param latency Latency to record.
+   */
+  void record(std::chrono::nanoseconds latency) {
+    const uint64_t value = latency.count() > 0 ? static_cast<uint64_t>(latency.count()) : 0;
+    m_buckets[index(value)].fetch_add(1, std::memory_order_relaxed);
+    m_count.fetch_add(1, std::memory_order_relaxed);
+    uint64_t max = m_max.load(std::memory_order_relaxed);
+    while (value > max && !m_max.compare_exchange_weak(max, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  /**
+   * Get number of recorded latencies.
+   * @return Number of recorded latencies.
+   */
+  uint64_t getCount() const {
+    return m_count.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Get maximal recorded latency.
+   * @return Maximal latency.
+   */
+  std::chrono::nanoseconds getMax() const {
+    return std::chrono::nanoseconds(m_max.load(std::memory_order_relaxed));
+  }
+
+  /**
+   * Get latency, which is not exceeded by the given percentage of recorded latencies.
+   * The upper bound of the matching bucket is returned, so the result is never too optimistic.
+   * @param percentile Percentile between 0 and 100, e.g. 99.9.
+   * @return Latency of percentile, 0 if nothing was recorded.
+   */
+  std::chrono::nanoseconds getPercentile(double percentile) const;
+
+  /**
+   * Clear all recorded latencies, must not be called concurrently to record().
+   */
+  void reset();
+
+ private:
+  /** Number of bits of linear sub buckets. */
+  static constexpr unsigned SUB_BUCKET_BITS = 6;
+
+  /** Number of linear sub buckets of the first bucket. */
+  static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+
+  /** Number of sub buckets of each further power of two. */
+  static constexpr uint64_t HALF_SUB_BUCKETS = SUB_BUCKETS / 2;
+
+  /** Number of buckets to cover all 64 bit values. */
+  static constexpr size_t BUCKETS = SUB_BUCKETS + (64 - SUB_BUCKET_BITS) * HALF_SUB_BUCKETS;
+
+  /** Get bucket of value. */
+  static size_t index(uint64_t value) {
+    if (value < SUB_BUCKETS) {
+      return static_cast<size_t>(value);
+    }
+    const unsigned msb = 63 - static_cast<unsigned>(__builtin_clzll(value));
+    // highest bits of value in [HALF_SUB_BUCKETS, SUB_BUCKETS)
+    const uint64_t top = value >> (msb - SUB_BUCKET_BITS + 1);
+    return static_cast<size_t>(SUB_BUCKETS + (msb - SUB_BUCKET_BITS) * HALF_SUB_BUCKETS +
+                               (top - HALF_SUB_BUCKETS));
+  }
+
+  /** Get highest value of bucket. */
+  static uint64_t upperBound(size_t index);
+
+  /** Recorded latencies per bucket. */
+  std::array<std::atomic<uint64_t>, BUCKETS> m_buckets{};
+
+  /** Number of recorded latencies. */
+  std::atomic<uint64_t> m_count{0};
+
+  /** Maximal recorded latency in nanoseconds. */
+  std::atomic<uint64_t> m_max{0};
+};
+
+}  // namespace fdl
@@ -0,0 +1,153 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <utility>
+
+#include "Loop.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Subscriber for state topics, where only the newest message is of interest.
+ * Instead of a queue a wait free triple buffer is used: the publisher always writes into its own
+ * back buffer and swaps it with the middle buffer, the reader swaps the middle buffer with its
+ * front buffer. Writes never fail and a read always returns the freshest message in constant time.
+ * Older messages, which were not read in time, are silently replaced.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class LatestSubscriber : public ISubscriber<MessageT> {
+ public:
+  /**
+   * Create named subscriber.
+   * If a loop reference is passed, this loop will be woken up on each data update.
+   * @param name Name of subscriber.
+   * @param loop Loop or WaitSet trigger which will be woken up on each data update if wanted.
+   */
+  explicit LatestSubscriber(const std::string& name, IWakeable* const loop = nullptr);
+
+  ~LatestSubscriber() override = default;
+
+  /**
+   * Get name of subscriber.
+   * @return name Name of subscriber.
+   */
+  const std::string& getName() const override {
+    return m_name;
+  }
+
+  /**
+   * Write data to subscriber buffer, replacing an unread message.
+   * Write is thread safe and wait free.
+   * @param message Message data to be written.
+   * @return Always true.
+   */
+  bool write(const MessageT& message) override;
+
+  /**
+   * Move data into subscriber buffer, replacing an unread message.
+   * @param message Message data to be moved.
+   * @return Always true.
+   */
+  bool write(MessageT&& message) override;
+
+  /**
+   * Write batch of messages, only the last message of the batch is stored.
+   * @param messages Messages to be written.
+   * @param size Number of messages.
+   * @return Always size.
+   */
+  size_t write(const MessageT* messages, size_t size) override;
+
+  /**
+   * Read newest data into an output variable.
+   * Read is thread safe and wait free.
+   * @param message Contains read data, if new data was received.
+   * @return true if new data was written since last read, false otherwise.
+   */
+  bool read(MessageT& message);
+
+ private:
+  /** Swap written back buffer with middle buffer and wake loop. */
+  void publish();
+
+  /** Marks middle buffer as written and not read yet. */
+  static constexpr uint8_t FRESH = 0x4;
+
+  /** Mask to extract buffer index of middle buffer state. */
+  static constexpr uint8_t INDEX = 0x3;
+
+  /** Name of subscriber. */
+  const std::string m_name{};
+
+  /** Loop to be woken up on each data write. */
+  IWakeable* const m_loop{};
+
+  /** Triple buffer, each buffer on its own cache line. */
+  struct alignas(64) Buffer {
+    MessageT message{};
+  } m_buffers[3]{};
+
+  /** Index of buffer owned by writer. */
+  alignas(64) uint8_t m_write_index{0};
+
+  /** Index and fresh state of buffer exchanged between writer and reader. */
+  alignas(64) std::atomic<uint8_t> m_middle{1};
+
+  /** Index of buffer owned by reader. */
+  alignas(64) uint8_t m_read_index{2};
+};
+
+template <typename MessageT>
+LatestSubscriber<MessageT>::LatestSubscriber(const std::string& name, IWakeable* const loop)
+    : m_name(name), m_loop(loop) {
+  EXPECT(!name.empty(), "Subscriber needs to be named.");
+}
+
+template <typename MessageT>
+bool LatestSubscriber<MessageT>::write(const MessageT& message) {
+  m_buffers[m_write_index].message = message;
+  publish();
+  return true;
+}
+
+template <typename MessageT>
+bool LatestSubscriber<MessageT>::write(MessageT&& message) {
+  m_buffers[m_write_index].message = std::move(message);
+  publish();
+  return true;
+}
+
+template <typename MessageT>
+void LatestSubscriber<MessageT>::publish() {
+  // publish written buffer and take over the previous middle buffer
+  m_write_index = m_middle.exchange(m_write_index | FRESH, std::memory_order_acq_rel) & INDEX;
+  if (m_loop != nullptr) {
+    m_loop->wake();
+  }
+}
+
+template <typename MessageT>
+size_t LatestSubscriber<MessageT>::write(const MessageT* messages, size_t size) {
+  if (size > 0) {
+    write(messages[size - 1]);  // NOLINT
+  }
+  return size;
+}
+
+template <typename MessageT>
+bool LatestSubscriber<MessageT>::read(MessageT& message) {
+  if ((m_middle.load(std::memory_order_relaxed) & FRESH) == 0) {
+    return false;
+  }
+  m_read_index = m_middle.exchange(m_read_index, std::memory_order_acq_rel) & INDEX;
+  message = std::move(m_buffers[m_read_index].message);
+  return true;
+}
+
+}  // namespace fdl
@@ -27,6 +27,11 @@ void Loop::setPeriod(std::chrono::microseconds period) {
   m_thread->setPeriod(period);
 }
 
+void Loop::setEventTriggered(bool is_event_triggered) {
+  EXPECT(m_is_configured, "Loop not configured: call setEventTriggered in onConfigure.");
+  m_thread->setEventTriggered(is_event_triggered);
+}
+
 void Loop::setStackSize(size_t size) {
   EXPECT(m_is_configured, "Loop not configured: call setStackSize in onConfigure.");
   m_thread->setStackSize(size);
@@ -52,8 +57,15 @@ bool Loop::start() {
   ENSURE(!m_is_running, "Loop already running.");
 
   if (onStart()) {
-    m_thread->create();
+    // thread runs onRun() right after creation, which may already wake the loop
     m_is_running = true;
+    try {
+      m_thread->create();
+    } catch (...) {
+      // loop can be started again
+      m_is_running = false;
+      throw;
+    }
     return true;
   }
   return false;
@@ -15,20 +15,28 @@ namespace test::loop {
 class BASE_LoopTest;
 }  // namespace test::loop
 
-class ILoop {
+/** Interface of objects, which can be woken up on data updates, e.g. loops. */
+class IWakeable {
  public:
-  virtual ~ILoop() = default;
+  virtual ~IWakeable() = default;
+
+  virtual void wake() = 0;
+};
+
+class ILoop : public IWakeable {
+ public:
+  ~ILoop() override = default;
 
   virtual void setPeriod(std::chrono::microseconds period) = 0;
 
+  virtual void setEventTriggered(bool is_event_triggered) = 0;
+
   virtual void setStackSize(size_t size) = 0;
 
   virtual bool configure() = 0;
 
   virtual bool start() = 0;
 
-  virtual void wake() = 0;
-
   virtual bool stop() = 0;
 
   virtual void cancel() = 0;
@@ -42,7 +50,8 @@ class ILoop {
  *
  * If a Loop is configured with a period (setPeriodUs()), onRun() will be called periodically
  * with the configured period. If no period is set, the loop needs to be woken up with wake()
- * (e.g. when new data is available) to trigger onRun().
+ * (e.g. when new data is available) to trigger onRun(). A periodic loop, which is configured as
+ * not event triggered (setEventTriggered(false)), ignores wake() and only runs on its period.
  */
 class Loop : public ILoop {
  public:
@@ -59,6 +68,13 @@ class Loop : public ILoop {
    */
   void setPeriod(std::chrono::microseconds period) override;
 
+  /**
+   * Set whether a periodic loop is also woken up by wake() (default true). Purely periodic loops
+   * ignore wake(), e.g. of subscribers, and only run on their period.
+   * @param is_event_triggered false if onRun() is only triggered by the period.
+   */
+  void setEventTriggered(bool is_event_triggered) override;
+
   /**
    * Set stack size of underlying thread, if default is non enough.
    * @param size New stack size in Byte.
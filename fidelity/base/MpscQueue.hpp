@@ -0,0 +1,282 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Copy.hpp"
+
+namespace fdl {
+
+/**
+ * Bounded lock free multi producer single consumer queue.
+ * Each slot carries a sequence number, which tells producers whether the slot is free and the
+ * consumer whether it was written. Producers claim positions with a compare and swap on the write
+ * position, so messages of one producer keep their order. All slots are allocated on creation.
+ * Interface follows boost::lockfree::spsc_queue for use as queue type of Subscriber.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class MpscQueue {
+ public:
+  using value_type = MessageT;
+
+  /**
+   * Create queue, all slots are allocated on creation.
+   * @param capacity Number of messages, which can be stored.
+   */
+  explicit MpscQueue(size_t capacity);
+
+  MpscQueue(const MpscQueue&) = delete;
+  MpscQueue(MpscQueue&&) = delete;
+  MpscQueue& operator=(MpscQueue&&) = delete;
+  MpscQueue& operator=(const MpscQueue&) = delete;
+
+  ~MpscQueue();
+
+  /**
+   * Push message to queue.
+   * Can be called by multiple producers concurrently.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(const MessageT& message);
+
+  /**
+   * Move message into queue.
+   * Can be called by multiple producers concurrently.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(MessageT&& message);
+
+  /**
+   * Construct message in place in queue.
+   * Can be called by multiple producers concurrently.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return true if message was pushed, false if queue is full.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args);
+
+  /**
+   * Push batch of messages to queue.
+   * Positions for the whole batch are claimed at once, so the batch is not interleaved with
+   * messages of other producers.
+   * @param messages Messages to push.
+   * @param size Number of messages.
+   * @return Number of pushed messages, which is either size or 0 if queue has not enough space.
+   */
+  size_t push(const MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message from queue.
+   * Must only be called by the consumer.
+   * @param message Contains popped message on success.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  bool pop(MessageT& message);
+
+  /**
+   * Pop batch of messages from queue.
+   * Must only be called by the consumer.
+   * @param messages Output buffer for popped messages.
+   * @param size Size of output buffer.
+   * @return Number of popped messages.
+   */
+  size_t pop(MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message and call functor for it.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(MessageT&).
+   * @param functor Functor called for the message.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  template <typename FunctorT>
+  bool consume_one(const FunctorT& functor);
+
+  /**
+   * Pop all messages and call functor for each of them.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(const MessageT&).
+   * @param functor Functor called for each message.
+   * @return Number of popped messages.
+   */
+  template <typename FunctorT>
+  size_t consume_all(const FunctorT& functor);
+
+  /**
+   * Get number of messages in queue, including messages which are just written.
+   * @return Number of messages available for reading.
+   */
+  size_t read_available() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+
+ private:
+  /** Queue slot, sequence equals position if free and position + 1 if written. */
+  struct Slot {
+    std::atomic<size_t> sequence{0};
+    typename std::aligned_storage<sizeof(MessageT), alignof(MessageT)>::type storage{};
+
+    MessageT* message() {
+      return std::launder(reinterpret_cast<MessageT*>(&storage));  // NOLINT
+    }
+  };
+
+  /** Claim size positions for writing, see push(). */
+  bool claim(size_t size, size_t& head);
+
+  /** Pop message at read position by calling functor, see pop(). */
+  template <typename FunctorT>
+  bool consume(size_t tail, const FunctorT& functor);
+
+  /** Capacity of queue. */
+  const size_t m_capacity{0};
+
+  /** Queue slots. */
+  std::unique_ptr<Slot[]> m_slots{};
+
+  /** Write position, claimed by producers. */
+  alignas(64) std::atomic<size_t> m_head{0};
+
+  /** Read position, only written by consumer. */
+  alignas(64) std::atomic<size_t> m_tail{0};
+};
+
+template <typename MessageT>
+MpscQueue<MessageT>::MpscQueue(size_t capacity)
+    : m_capacity(capacity), m_slots(std::make_unique<Slot[]>(capacity)) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+  for (size_t index = 0; index < capacity; ++index) {
+    m_slots[index].sequence.store(index, std::memory_order_relaxed);
+  }
+}
+
+template <typename MessageT>
+MpscQueue<MessageT>::~MpscQueue() {
+  consume_all([](const MessageT& /*message*/) {});
+}
+
+template <typename MessageT>
+bool MpscQueue<MessageT>::push(const MessageT& message) {
+  return emplace(message);
+}
+
+template <typename MessageT>
+bool MpscQueue<MessageT>::push(MessageT&& message) {
+  return emplace(std::move(message));
+}
+
+template <typename MessageT>
+template <typename... ArgsT>
+bool MpscQueue<MessageT>::emplace(ArgsT&&... args) {
+  size_t head{0};
+  if (!claim(1, head)) {
+    return false;
+  }
+  Slot& slot = m_slots[head % m_capacity];
+  copy::construct(slot.message(), std::forward<ArgsT>(args)...);
+  slot.sequence.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+bool MpscQueue<MessageT>::claim(size_t size, size_t& head) {
+  if (size == 0 || size > m_capacity) {
+    return false;
+  }
+
+  head = m_head.load(std::memory_order_relaxed);
+  while (true) {
+    // slots are freed in order, so the whole batch is free if its last slot is free
+    const size_t last = head + size - 1;
+    const size_t sequence = m_slots[last % m_capacity].sequence.load(std::memory_order_acquire);
+    if (sequence != last) {
+      if (sequence < last) {
+        return false;  // full
+      }
+      head = m_head.load(std::memory_order_relaxed);  // other producer was faster
+    } else if (m_head.compare_exchange_weak(head, head + size, std::memory_order_relaxed)) {
+      return true;
+    }
+  }
+}
+
+template <typename MessageT>
+size_t MpscQueue<MessageT>::push(const MessageT* messages, size_t size) {
+  size_t head{0};
+  if (!claim(size, head)) {
+    return 0;
+  }
+
+  for (size_t index = 0; index < size; ++index) {
+    const size_t position = head + index;
+    Slot& slot = m_slots[position % m_capacity];
+    copy::construct(slot.message(), messages[index]);
+    slot.sequence.store(position + 1, std::memory_order_release);
+  }
+  return size;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+bool MpscQueue<MessageT>::consume(size_t tail, const FunctorT& functor) {
+  Slot& slot = m_slots[tail % m_capacity];
+  if (slot.sequence.load(std::memory_order_acquire) != tail + 1) {
+    return false;  // empty or not completely written yet
+  }
+  functor(*slot.message());
+  slot.message()->~MessageT();
+  slot.sequence.store(tail + m_capacity, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+bool MpscQueue<MessageT>::pop(MessageT& message) {
+  return pop(&message, 1) == 1;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+bool MpscQueue<MessageT>::consume_one(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  if (!consume(tail, functor)) {
+    return false;
+  }
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+size_t MpscQueue<MessageT>::pop(MessageT* messages, size_t size) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  size_t count = 0;
+  while (count < size &&
+         consume(tail + count, [&](MessageT& message) { messages[count] = std::move(message); })) {
+    ++count;
+  }
+  m_tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+size_t MpscQueue<MessageT>::consume_all(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  size_t count = 0;
+  while (consume(tail + count, functor)) {
+    ++count;
+  }
+  m_tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+}  // namespace fdl
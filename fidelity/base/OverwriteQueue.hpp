@@ -0,0 +1,300 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+
+namespace fdl {
+
+/**
+ * Lock free single producer single consumer queue, which overwrites the oldest message if full.
+ * Messages are stored in capacity + 2 buffers, which are owned either by the queue ring, the
+ * producer or the consumer. The ring only contains buffer indices, so the producer can drop the
+ * oldest entry by advancing the read position with a compare and swap, while the consumer claims
+ * entries the same way. A buffer is never written while the consumer still copies it.
+ * Interface follows boost::lockfree::spsc_queue for use as queue type of Subscriber.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class OverwriteQueue {
+ public:
+  using value_type = MessageT;
+
+  /**
+   * Create queue, all buffers are allocated on creation.
+   * @param capacity Number of messages, which are kept in queue.
+   */
+  explicit OverwriteQueue(size_t capacity);
+
+  OverwriteQueue(const OverwriteQueue&) = delete;
+  OverwriteQueue(OverwriteQueue&&) = delete;
+  OverwriteQueue& operator=(OverwriteQueue&&) = delete;
+  OverwriteQueue& operator=(const OverwriteQueue&) = delete;
+
+  ~OverwriteQueue() = default;
+
+  /**
+   * Push message to queue, the oldest message is dropped if queue is full.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return Always true.
+   */
+  bool push(const MessageT& message);
+
+  /**
+   * Move message into queue, the oldest message is dropped if queue is full.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return Always true.
+   */
+  bool push(MessageT&& message);
+
+  /**
+   * Construct message and move it into queue, the oldest message is dropped if queue is full.
+   * Buffers hold constructed messages, so the message is move assigned to a free buffer.
+   * Must only be called by the producer.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return Always true.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args) {
+    return push(MessageT(std::forward<ArgsT>(args)...));
+  }
+
+  /**
+   * Push batch of messages to queue, oldest messages are dropped if queue gets full.
+   * The write position is published once for the whole batch.
+   * Must only be called by the producer.
+   * @param messages Messages to push.
+   * @param size Number of messages.
+   * @return Always size.
+   */
+  size_t push(const MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message from queue.
+   * Must only be called by the consumer.
+   * @param message Contains popped message on success.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  bool pop(MessageT& message);
+
+  /**
+   * Pop batch of messages from queue.
+   * Each message is claimed separately, because producer may drop messages concurrently.
+   * Must only be called by the consumer.
+   * @param messages Output buffer for popped messages.
+   * @param size Size of output buffer.
+   * @return Number of popped messages.
+   */
+  size_t pop(MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message and call functor for it.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(MessageT&).
+   * @param functor Functor called for the message.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  template <typename FunctorT>
+  bool consume_one(const FunctorT& functor);
+
+  /**
+   * Pop all messages and call functor for each of them.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(const MessageT&).
+   * @param functor Functor called for each message.
+   * @return Number of popped messages.
+   */
+  template <typename FunctorT>
+  size_t consume_all(const FunctorT& functor);
+
+  /**
+   * Get number of messages in queue.
+   * @return Number of messages available for reading.
+   */
+  size_t read_available() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+
+  /**
+   * Get number of messages dropped because the queue was full.
+   * @return Number of overwritten messages.
+   */
+  uint64_t dropped() const {
+    return m_dropped.load(std::memory_order_relaxed);
+  }
+
+ private:
+  /** Write message to ring position head, dropping the oldest message if ring is full. */
+  template <typename ValueT>
+  void store(ValueT&& message, uint64_t head);
+
+  /** Claim oldest ring entry, see pop(). */
+  bool claim(size_t& buffer);
+
+  /** Marks that producer owns no spare buffer. */
+  static constexpr size_t NO_BUFFER = SIZE_MAX;
+
+  /** Capacity of ring. */
+  const size_t m_capacity{0};
+
+  /** Message buffers. */
+  std::unique_ptr<MessageT[]> m_buffers{};
+
+  /** Ring of buffer indices. */
+  std::unique_ptr<std::atomic<size_t>[]> m_ring{};
+
+  /** Buffers released by consumer and ready to be written by producer. */
+  boost::lockfree::spsc_queue<size_t> m_free_buffers;
+
+  /** Buffer of a dropped message, owned by producer. */
+  size_t m_spare_buffer{NO_BUFFER};
+
+  /** Write position, only written by producer. */
+  alignas(64) std::atomic<uint64_t> m_head{0};
+
+  /** Number of dropped messages, only written by producer. */
+  std::atomic<uint64_t> m_dropped{0};
+
+  /** Read position, advanced by consumer on read and by producer on drop. */
+  alignas(64) std::atomic<uint64_t> m_tail{0};
+};
+
+template <typename MessageT>
+OverwriteQueue<MessageT>::OverwriteQueue(size_t capacity)
+    : m_capacity(capacity),
+      m_buffers(std::make_unique<MessageT[]>(capacity + 2)),
+      m_ring(std::make_unique<std::atomic<size_t>[]>(capacity)),
+      m_free_buffers(capacity + 2) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+  for (size_t index = 0; index < capacity + 2; ++index) {
+    m_free_buffers.push(index);
+  }
+}
+
+template <typename MessageT>
+bool OverwriteQueue<MessageT>::push(const MessageT& message) {
+  const uint64_t head = m_head.load(std::memory_order_relaxed);
+  store(message, head);
+  m_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+bool OverwriteQueue<MessageT>::push(MessageT&& message) {
+  const uint64_t head = m_head.load(std::memory_order_relaxed);
+  store(std::move(message), head);
+  m_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+size_t OverwriteQueue<MessageT>::push(const MessageT* messages, size_t size) {
+  // messages exceeding capacity would be dropped by the same batch, so only published entries are
+  // dropped and the read position never passes the write position
+  const size_t skipped = size > m_capacity ? size - m_capacity : 0;
+  if (skipped > 0) {
+    m_dropped.store(m_dropped.load(std::memory_order_relaxed) + skipped, std::memory_order_relaxed);
+  }
+  const uint64_t head = m_head.load(std::memory_order_relaxed);
+  for (size_t index = skipped; index < size; ++index) {
+    store(messages[index], head + index - skipped);  // NOLINT
+  }
+  m_head.store(head + size - skipped, std::memory_order_release);
+  return size;
+}
+
+template <typename MessageT>
+template <typename ValueT>
+void OverwriteQueue<MessageT>::store(ValueT&& message, uint64_t head) {
+  size_t buffer = m_spare_buffer;
+  if (buffer == NO_BUFFER) {
+    // can't fail: ring holds at most capacity buffers and consumer at most one
+    m_free_buffers.pop(buffer);
+  }
+  m_spare_buffer = NO_BUFFER;
+  m_buffers[buffer] = std::forward<ValueT>(message);
+
+  uint64_t tail = m_tail.load(std::memory_order_acquire);
+  while (head - tail >= m_capacity) {
+    // drop oldest message, ring entries are only written by producer
+    const size_t oldest = m_ring[tail % m_capacity].load(std::memory_order_relaxed);
+    if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel,
+                                     std::memory_order_acquire)) {
+      m_spare_buffer = oldest;
+      m_dropped.store(m_dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+      break;
+    }
+  }
+
+  m_ring[head % m_capacity].store(buffer, std::memory_order_relaxed);
+}
+
+template <typename MessageT>
+bool OverwriteQueue<MessageT>::claim(size_t& buffer) {
+  uint64_t tail = m_tail.load(std::memory_order_relaxed);
+  do {
+    if (tail == m_head.load(std::memory_order_acquire)) {
+      return false;
+    }
+    // entry is valid, if no one advanced the read position in between
+    buffer = m_ring[tail % m_capacity].load(std::memory_order_relaxed);
+  } while (!m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_acq_rel,
+                                         std::memory_order_relaxed));
+  return true;
+}
+
+template <typename MessageT>
+bool OverwriteQueue<MessageT>::pop(MessageT& message) {
+  size_t buffer{0};
+  if (!claim(buffer)) {
+    return false;
+  }
+  message = std::move(m_buffers[buffer]);
+  m_free_buffers.push(buffer);
+  return true;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+bool OverwriteQueue<MessageT>::consume_one(const FunctorT& functor) {
+  size_t buffer{0};
+  if (!claim(buffer)) {
+    return false;
+  }
+  functor(m_buffers[buffer]);
+  m_free_buffers.push(buffer);
+  return true;
+}
+
+template <typename MessageT>
+size_t OverwriteQueue<MessageT>::pop(MessageT* messages, size_t size) {
+  size_t count = 0;
+  while (count < size && pop(messages[count])) {  // NOLINT
+    ++count;
+  }
+  return count;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+size_t OverwriteQueue<MessageT>::consume_all(const FunctorT& functor) {
+  size_t count = 0;
+  size_t buffer{0};
+  while (claim(buffer)) {
+    functor(m_buffers[buffer]);
+    m_free_buffers.push(buffer);
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace fdl
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <pthread.h>
+
 #include <contract/contract_assert.hpp>
 
 #include <mutex>
@@ -8,8 +10,10 @@ namespace fdl {
 
 /**
  * Mutex with PTHREAD_PRIO_INHERIT attribute to avoid priority inversion.
- * The thread which holds the look on this mutes will get the scheduling parameters of the high
- * priority thread which is waiting on the lock.
+ * The thread which holds the lock on this mutex will get the scheduling parameters of the high
+ * priority thread which is waiting on the lock. Loops and subscribers don't lock since they wait on
+ * futexes, the mutex is provided for applications sharing data between realtime and non realtime
+ * threads.
  * @see http://linux.die.net/man/3/pthread_mutexattr_setprotocol
  */
 class PrioMutex : public std::mutex {
@@ -2,9 +2,20 @@
 
 #include <contract/contract_assert.hpp>
 
-#include <list>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Stamped.hpp"
+#include "Statistics.hpp"
 
 namespace fdl {
 
@@ -14,16 +25,36 @@ class ISubscriber;
 /**
  * Publishing part of communication between running loops.
  * For publishing data thread safe and lock free.
+ * Messages are copied into each subscriber. Large messages can be published without copying by
+ * using Sample<MessageT> loaned from a SamplePool as message type. Publishers of Stamped<MessageT>
+ * stamp each message with the time of writing, batches keep the stamps set by the caller and
+ * messages left unstamped aren't recorded by latency histograms.
+ *
+ * Subscribers can be added and removed by non realtime threads while the publisher is writing.
+ * Subscribers are kept in a contiguous array, which is never modified: an update builds a new
+ * array, swaps it in and frees the old array after a running write has finished. Writes neither
+ * lock nor allocate memory. Only one thread may write to a publisher.
+ * @tparam MessageT Type of pubsub message.
  */
 template <typename MessageT>
 class Publisher {
  public:
+  /** Predicate selecting the messages a subscriber receives. */
+  using Filter = std::function<bool(const MessageT&)>;
+
   /**
    * Create publisher.
    * @param name Name of publisher.
    */
   explicit Publisher(const std::string& name);
 
+  Publisher(const Publisher&) = delete;
+  Publisher(Publisher&&) = delete;
+  Publisher& operator=(Publisher&&) = delete;
+  Publisher& operator=(const Publisher&) = delete;
+
+  ~Publisher() = default;
+
   /**
    * Get name of publisher.
    * @return name Name of publisher.
@@ -36,11 +67,25 @@ class Publisher {
    * Register new subscriber to publisher.
    * Each subscriber will receive data updates after successful subscription.
    * Name of new subscriber needs to be unique for publisher.
+   * Allocates memory, so must not be called by realtime threads.
+   * A filter is evaluated by the publisher before writing, so rejected messages neither take queue
+   * space nor wake the subscriber's loop. The filter is called by the writing thread and needs to
+   * be realtime safe if the publisher is written by a realtime thread.
    * @tparam MessageT Type of pubsub message.
    * @param subscriber Subscriber which will be added.
+   * @param filter Predicate selecting the messages written to subscriber, all messages if empty.
    * @return true on success, false otherwise.
    */
-  bool subscribe(std::shared_ptr<ISubscriber<MessageT>> subscriber);
+  bool subscribe(std::shared_ptr<ISubscriber<MessageT>> subscriber, Filter filter = nullptr);
+
+  /**
+   * Remove subscriber from publisher.
+   * The subscriber won't receive data updates after unsubscribe returned. Waits for a running
+   * write and allocates memory, so must not be called by realtime threads.
+   * @param subscriber Subscriber which will be removed.
+   * @return true on success, false if subscriber was not subscribed.
+   */
+  bool unsubscribe(const std::shared_ptr<ISubscriber<MessageT>>& subscriber);
 
   /**
    * Publish data to subscriber.
@@ -49,12 +94,103 @@ class Publisher {
    */
   bool write(const MessageT& message);
 
+  /**
+   * Publish data to subscriber, moving it into the last subscriber.
+   * All other subscribers receive a copy.
+   * @param message Message data to publish.
+   * @return true if data could be written.
+   */
+  bool write(MessageT&& message);
+
+  /**
+   * Construct message and publish it, moving it into the last subscriber.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return true if data could be written.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args) {
+    return write(MessageT(std::forward<ArgsT>(args)...));
+  }
+
+  /**
+   * Publish data to subscriber, waiting for free space in full subscribers.
+   * Blocking write for non realtime producers, which would otherwise spin on full subscribers.
+   * Subscribers are written one after the other, the timeout applies to the whole write. Only
+   * subscribers with blocking writes enabled are waited for (see Subscriber::setBlockingWrites()).
+   * Must not be called by realtime threads, which should use write().
+   * @param message Message data to publish.
+   * @param timeout Maximal duration to wait for free space.
+   * @return true if data could be written to all subscribers.
+   */
+  bool writeFor(const MessageT& message, std::chrono::nanoseconds timeout);
+
+  /**
+   * Publish batch of messages to subscriber.
+   * Each subscriber receives the whole batch with a single write. Subscribers with a filter
+   * receive the accepted messages one by one.
+   * @param messages Messages to publish.
+   * @param size Number of messages.
+   * @return true if all messages could be written.
+   */
+  bool write(const MessageT* messages, size_t size);
+
+  /**
+   * Get runtime statistics: published messages, messages which could not be written to all
+   * subscribers and time of last write. Can be called by any thread.
+   * @return Snapshot of statistics.
+   */
+  Statistics getStatistics() const {
+    return m_statistics.getStatistics();
+  }
+
  private:
+  /** Registered subscriber with its filter. */
+  struct Subscription {
+    std::shared_ptr<ISubscriber<MessageT>> subscriber;
+    Filter filter;
+
+    bool accepts(const MessageT& message) const {
+      return !filter || filter(message);
+    }
+  };
+
+  using SubscriberList = std::vector<Subscription>;
+
+  /** Swap in new subscriber list and free the old one after a running write has finished. */
+  void update(std::unique_ptr<SubscriberList> subscriber_list);
+
+  /** Write message to all subscribers, see writeFor(). */
+  bool writeAllFor(const MessageT& message, std::chrono::nanoseconds timeout);
+
+  /** Mark start of write and get current subscriber list. */
+  const SubscriberList& beginWrite() {
+    m_write_epoch.fetch_add(1, std::memory_order_seq_cst);
+    return *m_active_list.load(std::memory_order_seq_cst);
+  }
+
+  /** Mark end of write, subscriber list must not be used afterwards. */
+  void endWrite() {
+    m_write_epoch.fetch_add(1, std::memory_order_release);
+  }
+
   /** Name of publisher. */
   const std::string m_name{};
 
-  /** List of all registered subscribers. */
-  std::list<std::shared_ptr<ISubscriber<MessageT>>> m_subscriber_list{};
+  /** Serializes updates of the subscriber list. */
+  std::mutex m_update_mutex{};
+
+  /** Owner of the current list of all registered subscribers. */
+  std::unique_ptr<SubscriberList> m_subscriber_list{std::make_unique<SubscriberList>()};
+
+  /** Subscriber list used by writes. */
+  std::atomic<const SubscriberList*> m_active_list{m_subscriber_list.get()};
+
+  /** Write counter, which is odd while a write is running. */
+  std::atomic<uint64_t> m_write_epoch{0};
+
+  /** Runtime statistics. */
+  StatisticsCounters m_statistics{};
 };
 
 template <typename MessageT>
@@ -63,7 +199,8 @@ Publisher<MessageT>::Publisher(const std::string& name) : m_name(name) {
 }
 
 template <typename MessageT>
-bool Publisher<MessageT>::subscribe(std::shared_ptr<ISubscriber<MessageT>> subscriber) {
+bool Publisher<MessageT>::subscribe(std::shared_ptr<ISubscriber<MessageT>> subscriber,
+                                    Filter filter) {
   if (subscriber == nullptr) {
     return false;
   }
@@ -71,31 +208,150 @@ bool Publisher<MessageT>::subscribe(std::shared_ptr<ISubscriber<MessageT>> subsc
     return false;
   }
 
+  std::lock_guard<std::mutex> lock(m_update_mutex);
+
   auto found_subscriber =
-      std::find_if(m_subscriber_list.begin(), m_subscriber_list.end(),
-                   [&](const std::shared_ptr<ISubscriber<MessageT>>& subscriber_it) {
-                     return subscriber_it->getName() == subscriber->getName();
+      std::find_if(m_subscriber_list->begin(), m_subscriber_list->end(),
+                   [&](const Subscription& subscription) {
+                     return subscription.subscriber->getName() == subscriber->getName();
                    });
 
   // subscriber already added
-  if (found_subscriber != m_subscriber_list.end()) {
+  if (found_subscriber != m_subscriber_list->end()) {
+    return false;
+  }
+  // add to copy of subscriber list
+  auto subscriber_list = std::make_unique<SubscriberList>(*m_subscriber_list);
+  subscriber_list->push_back({std::move(subscriber), std::move(filter)});
+  update(std::move(subscriber_list));
+
+  return true;
+}
+
+template <typename MessageT>
+bool Publisher<MessageT>::unsubscribe(const std::shared_ptr<ISubscriber<MessageT>>& subscriber) {
+  std::lock_guard<std::mutex> lock(m_update_mutex);
+
+  auto found_subscriber =
+      std::find_if(m_subscriber_list->begin(), m_subscriber_list->end(),
+                   [&](const Subscription& subscription) {
+                     return subscription.subscriber == subscriber;
+                   });
+
+  // subscriber not added
+  if (subscriber == nullptr || found_subscriber == m_subscriber_list->end()) {
     return false;
   }
-  // add to subscriber list
-  m_subscriber_list.push_back(subscriber);
+  // remove from copy of subscriber list
+  auto subscriber_list = std::make_unique<SubscriberList>(*m_subscriber_list);
+  subscriber_list->erase(subscriber_list->begin() +
+                         (found_subscriber - m_subscriber_list->begin()));
+  update(std::move(subscriber_list));
 
   return true;
 }
 
+template <typename MessageT>
+void Publisher<MessageT>::update(std::unique_ptr<SubscriberList> subscriber_list) {
+  m_active_list.store(subscriber_list.get(), std::memory_order_seq_cst);
+
+  // a write, which started before the swap, may still use the old list
+  const uint64_t epoch = m_write_epoch.load(std::memory_order_seq_cst);
+  if (epoch % 2 == 1) {
+    while (m_write_epoch.load(std::memory_order_acquire) == epoch) {
+      std::this_thread::yield();
+    }
+  }
+  m_subscriber_list = std::move(subscriber_list);
+}
+
 template <typename MessageT>
 bool Publisher<MessageT>::write(const MessageT& message) {
+  if constexpr (IsStamped<MessageT>::value) {
+    MessageT stamped_message = message;
+    return write(std::move(stamped_message));
+  }
+  bool success = true;
+  for (auto& subscription : beginWrite()) {
+    if (subscription.accepts(message)) {
+      success &= subscription.subscriber->write(message);
+    }
+  }
+  endWrite();
+  m_statistics.recordPublish(success ? 1 : 0, 1);
+  return success;
+}
+
+template <typename MessageT>
+bool Publisher<MessageT>::write(MessageT&& message) {
+  if constexpr (IsStamped<MessageT>::value) {
+    message.stamp = std::chrono::steady_clock::now();
+  }
+  const SubscriberList& subscriber_list = beginWrite();
+  // find last subscriber accepting the message, each filter is evaluated once
+  size_t last = subscriber_list.size();
+  while (last > 0 && !subscriber_list[last - 1].accepts(message)) {
+    --last;
+  }
+  bool success = true;
+  for (size_t index = 0; index + 1 < last; ++index) {
+    if (subscriber_list[index].accepts(message)) {
+      success &= subscriber_list[index].subscriber->write(static_cast<const MessageT&>(message));
+    }
+  }
+  if (last > 0) {
+    success &= subscriber_list[last - 1].subscriber->write(std::move(message));
+  }
+  endWrite();
+  m_statistics.recordPublish(success ? 1 : 0, 1);
+  return success;
+}
+
+template <typename MessageT>
+bool Publisher<MessageT>::writeFor(const MessageT& message, std::chrono::nanoseconds timeout) {
+  if constexpr (IsStamped<MessageT>::value) {
+    MessageT stamped_message = message;
+    stamped_message.stamp = std::chrono::steady_clock::now();
+    return writeAllFor(stamped_message, timeout);
+  }
+  return writeAllFor(message, timeout);
+}
+
+template <typename MessageT>
+bool Publisher<MessageT>::writeAllFor(const MessageT& message, std::chrono::nanoseconds timeout) {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
   bool success = true;
-  for (auto& subscriber : m_subscriber_list) {
-    if (subscriber != nullptr) {  // TODO(sk) ensure
-      success &= subscriber->write(message);
+  for (auto& subscription : beginWrite()) {
+    if (subscription.accepts(message)) {
+      success &= subscription.subscriber->writeFor(message,
+                                                   deadline - std::chrono::steady_clock::now());
     }
   }
+  endWrite();
+  m_statistics.recordPublish(success ? 1 : 0, 1);
   return success;
 }
 
+template <typename MessageT>
+bool Publisher<MessageT>::write(const MessageT* messages, size_t size) {
+  size_t written = size;
+  for (auto& subscription : beginWrite()) {
+    if (!subscription.filter) {
+      written = std::min(written, subscription.subscriber->write(messages, size));
+      continue;
+    }
+    // accepted messages are written one by one until the subscriber is full
+    for (size_t index = 0; index < size; ++index) {
+      if (subscription.filter(messages[index]) &&                // NOLINT
+          !subscription.subscriber->write(messages[index])) {  // NOLINT
+        written = std::min(written, index);
+        break;
+      }
+    }
+  }
+  endWrite();
+  m_statistics.recordPublish(written, size);
+  return written == size;
+}
+
 }  // namespace fdl
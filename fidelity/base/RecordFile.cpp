@@ -0,0 +1,175 @@
+#include "RecordFile.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <algorithm>
+#include <cstring>
+
+namespace fdl {
+
+namespace {
+
+/** Header at start of each record file. */
+struct RecordFileHeader {
+  /** Identifies record files. */
+  uint64_t magic{0};
+
+  /** Size of each record. */
+  uint64_t record_size{0};
+};
+
+constexpr uint64_t RECORD_FILE_MAGIC = 0x66646c7265636f72;
+
+size_t roundUpToPages(size_t size) {
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  return (size + page_size - 1) / page_size * page_size;
+}
+
+}  // namespace
+
+RecordWriter::RecordWriter(const std::string& path, size_t record_size, size_t chunk_size)
+    : m_path(path), m_record_size(record_size), m_chunk_size(roundUpToPages(chunk_size)) {
+  EXPECT(!path.empty(), "Path must not be empty.");
+  EXPECT(record_size > 0, "Record size must be greater 0.");
+  EXPECT(chunk_size > 0, "Chunk size must be greater 0.");
+}
+
+RecordWriter::~RecordWriter() {
+  close();
+}
+
+bool RecordWriter::open() {
+  close();
+  m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+  // reset before close(), which truncates the new file to the written position
+  m_position = 0;
+  m_count = 0;
+  if (m_fd < 0 || !map(0)) {
+    close();
+    return false;
+  }
+  RecordFileHeader header;
+  header.magic = RECORD_FILE_MAGIC;
+  header.record_size = m_record_size;
+  std::memcpy(m_chunk, &header, sizeof(header));
+  m_position = sizeof(header);
+  return true;
+}
+
+bool RecordWriter::append(const void* record) {
+  if (m_chunk == nullptr) {
+    return false;
+  }
+  // records may span chunk boundaries
+  const char* data = static_cast<const char*>(record);
+  const uint64_t start = m_position;
+  size_t remaining = m_record_size;
+  while (remaining > 0) {
+    const uint64_t chunk = m_position / m_chunk_size;
+    if (chunk != m_chunk_index && !map(chunk)) {
+      // drop partially written record, so the file stays consistent
+      m_position = start;
+      return false;
+    }
+    const size_t offset = m_position % m_chunk_size;
+    const size_t size = std::min(remaining, m_chunk_size - offset);
+    std::memcpy(m_chunk + offset, data, size);
+    data += size;  // NOLINT
+    remaining -= size;
+    m_position += size;
+  }
+  ++m_count;
+  return true;
+}
+
+bool RecordWriter::close() {
+  if (m_chunk != nullptr) {
+    ::munmap(m_chunk, m_chunk_size);
+    m_chunk = nullptr;
+  }
+  if (m_fd < 0) {
+    return false;
+  }
+  // remove unused space of last chunk
+  const bool truncated = ::ftruncate(m_fd, static_cast<off_t>(m_position)) == 0;
+  ::close(m_fd);
+  m_fd = -1;
+  return truncated;
+}
+
+bool RecordWriter::map(uint64_t chunk) {
+  if (m_chunk != nullptr) {
+    ::munmap(m_chunk, m_chunk_size);
+    m_chunk = nullptr;
+  }
+  const auto offset = static_cast<off_t>(chunk * m_chunk_size);
+  if (::ftruncate(m_fd, offset + static_cast<off_t>(m_chunk_size)) != 0) {
+    return false;
+  }
+  void* data = ::mmap(nullptr, m_chunk_size, PROT_READ | PROT_WRITE, MAP_SHARED, m_fd, offset);
+  if (data == MAP_FAILED) {  // NOLINT
+    return false;
+  }
+  m_chunk = static_cast<char*>(data);
+  m_chunk_index = chunk;
+  return true;
+}
+
+RecordReader::RecordReader(const std::string& path, size_t record_size)
+    : m_path(path), m_record_size(record_size) {
+  EXPECT(!path.empty(), "Path must not be empty.");
+  EXPECT(record_size > 0, "Record size must be greater 0.");
+}
+
+RecordReader::~RecordReader() {
+  close();
+}
+
+bool RecordReader::open() {
+  close();
+  const int fd = ::open(m_path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat status {};
+  if (::fstat(fd, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(RecordFileHeader)) {
+    ::close(fd);
+    return false;
+  }
+  m_size = static_cast<size_t>(status.st_size);
+  void* data = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (data == MAP_FAILED) {  // NOLINT
+    return false;
+  }
+  m_data = static_cast<const char*>(data);
+
+  RecordFileHeader header;
+  std::memcpy(&header, m_data, sizeof(header));
+  if (header.magic != RECORD_FILE_MAGIC || header.record_size != m_record_size) {
+    close();
+    return false;
+  }
+  m_count = (m_size - sizeof(header)) / m_record_size;
+  return true;
+}
+
+void RecordReader::close() {
+  if (m_data != nullptr) {
+    ::munmap(const_cast<char*>(m_data), m_size);  // NOLINT
+    m_data = nullptr;
+  }
+  m_count = 0;
+}
+
+const void* RecordReader::get(uint64_t index) const {
+  EXPECT(index < m_count, "Index exceeds number of records.");
+  return m_data + sizeof(RecordFileHeader) + index * m_record_size;  // NOLINT
+}
+
+}  // namespace fdl
@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace fdl {
+
+/**
+ * Append only writer of binary files with records of fixed size.
+ * The file is grown and memory mapped in chunks, so appending a record is a plain copy into the
+ * current chunk. The file is truncated to the written records on close. Opening, growing and
+ * closing the file allocates memory and does system calls, so a writer must only be used by non
+ * realtime threads.
+ */
+class RecordWriter {
+ public:
+  /**
+   * Create writer, the file is created by open().
+   * @param path Path of file.
+   * @param record_size Size of each record in Byte.
+   * @param chunk_size Size of mapped chunks in Byte, rounded up to a multiple of the page size.
+   */
+  RecordWriter(const std::string& path, size_t record_size, size_t chunk_size = 1024 * 1024);
+
+  RecordWriter(const RecordWriter&) = delete;
+  RecordWriter(RecordWriter&&) = delete;
+  RecordWriter& operator=(RecordWriter&&) = delete;
+  RecordWriter& operator=(const RecordWriter&) = delete;
+
+  ~RecordWriter();
+
+  /**
+   * Create or truncate file and map first chunk.
+   * @return true on success.
+   */
+  bool open();
+
+  /**
+   * Append record to file.
+   * @param record Record of record size.
+   * @return true on success, false if file is not open or could not be grown.
+   */
+  bool append(const void* record);
+
+  /**
+   * Unmap chunk and truncate file to the written records.
+   * @return true on success, false if file was not open or could not be truncated.
+   */
+  bool close();
+
+  /**
+   * Get number of appended records.
+   * @return Number of records.
+   */
+  uint64_t getCount() const {
+    return m_count;
+  }
+
+ private:
+  /** Map chunk at index, growing the file. */
+  bool map(uint64_t chunk);
+
+  /** Path of file. */
+  const std::string m_path{};
+
+  /** Size of records. */
+  const size_t m_record_size{0};
+
+  /** Size of chunks. */
+  const size_t m_chunk_size{0};
+
+  /** File descriptor, -1 if closed. */
+  int m_fd{-1};
+
+  /** Currently mapped chunk. */
+  char* m_chunk{nullptr};
+
+  /** Index of mapped chunk. */
+  uint64_t m_chunk_index{0};
+
+  /** Write position in file. */
+  uint64_t m_position{0};
+
+  /** Number of appended records. */
+  uint64_t m_count{0};
+};
+
+/**
+ * Reader of binary files written by RecordWriter.
+ * The whole file is mapped read only, records are accessed in place.
+ */
+class RecordReader {
+ public:
+  /**
+   * Create reader, the file is opened by open().
+   * @param path Path of file.
+   * @param record_size Size of each record in Byte, needs to match size of written records.
+   */
+  RecordReader(const std::string& path, size_t record_size);
+
+  RecordReader(const RecordReader&) = delete;
+  RecordReader(RecordReader&&) = delete;
+  RecordReader& operator=(RecordReader&&) = delete;
+  RecordReader& operator=(const RecordReader&) = delete;
+
+  ~RecordReader();
+
+  /**
+   * Open and map file.
+   * @return true on success, false if file does not exist or does not match record size.
+   */
+  bool open();
+
+  /**
+   * Unmap file.
+   */
+  void close();
+
+  /**
+   * Get number of records in file.
+   * @return Number of records.
+   */
+  uint64_t getCount() const {
+    return m_count;
+  }
+
+  /**
+   * Get record.
+   * @param index Index of record, less than getCount().
+   * @return Record of record size, not necessarily aligned.
+   */
+  const void* get(uint64_t index) const;
+
+ private:
+  /** Path of file. */
+  const std::string m_path{};
+
+  /** Size of records. */
+  const size_t m_record_size{0};
+
+  /** Mapped file. */
+  const char* m_data{nullptr};
+
+  /** Size of mapped file. */
+  size_t m_size{0};
+
+  /** Number of records in file. */
+  uint64_t m_count{0};
+};
+
+}  // namespace fdl
@@ -0,0 +1,224 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+#include "Publisher.hpp"
+#include "RecordFile.hpp"
+#include "Stamped.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Subscriber recording messages into a binary file for later replay.
+ * Writes stamp each message with the time of writing and queue it, like any Subscriber, so
+ * realtime publishers are not slowed down by file access. A non realtime loop, which is woken up
+ * on data updates or runs periodically, appends the queued messages to the file by flush().
+ * @tparam MessageT Type of pubsub message, needs to be trivially copyable.
+ */
+template <typename MessageT>
+class Recorder : public ISubscriber<MessageT> {
+  static_assert(std::is_trivially_copyable_v<MessageT>, "Message needs to be trivially copyable.");
+
+ public:
+  /**
+   * Create recorder, the file is created by open().
+   * @param name Name of subscriber.
+   * @param path Path of record file.
+   * @param capacity Capacity of queue between publisher and flush().
+   * @param loop Loop or WaitSet trigger which will be woken up on each data update if wanted.
+   */
+  Recorder(const std::string& name, const std::string& path, size_t capacity,
+           IWakeable* const loop = nullptr)
+      : m_subscriber(name, capacity, loop), m_writer(path, sizeof(Stamped<MessageT>)) {}
+
+  ~Recorder() override = default;
+
+  /**
+   * Get name of subscriber.
+   * @return name Name of subscriber.
+   */
+  const std::string& getName() const override {
+    return m_subscriber.getName();
+  }
+
+  /**
+   * Create record file, must not be called by realtime threads.
+   * @return true on success.
+   */
+  bool open() {
+    return m_writer.open();
+  }
+
+  /**
+   * Append queued messages to record file, must not be called by realtime threads.
+   * Messages which could not be appended, e.g. because the file is not open or the disk is full,
+   * are lost and counted, see getLostCount().
+   * @return Number of appended messages.
+   */
+  size_t flush() {
+    size_t count = 0;
+    size_t lost = 0;
+    m_subscriber.readAll([this, &count, &lost](const Stamped<MessageT>& record) {
+      if (m_writer.append(&record)) {
+        ++count;
+      } else {
+        ++lost;
+      }
+    });
+    if (lost > 0) {
+      m_lost.fetch_add(lost, std::memory_order_relaxed);
+    }
+    return count;
+  }
+
+  /**
+   * Get number of messages, which were queued but could not be appended to the record file.
+   * Messages dropped because the queue was full are counted by the statistics of the publisher.
+   * Can be called by any thread.
+   * @return Number of lost messages.
+   */
+  uint64_t getLostCount() const {
+    return m_lost.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Flush queued messages and close record file, must not be called by realtime threads.
+   * @return true on success.
+   */
+  bool close() {
+    flush();
+    return m_writer.close();
+  }
+
+  /**
+   * Queue message for recording.
+   * @param message Message data to be recorded.
+   * @return true if message could be queued.
+   */
+  bool write(const MessageT& message) override {
+    return m_subscriber.write(Stamped<MessageT>{message, std::chrono::steady_clock::now()});
+  }
+
+  /**
+   * Queue batch of messages for recording, all messages get the same stamp.
+   * @param messages Messages to be recorded.
+   * @param size Number of messages.
+   * @return Number of queued messages.
+   */
+  size_t write(const MessageT* messages, size_t size) override {
+    const auto stamp = std::chrono::steady_clock::now();
+    size_t count = 0;
+    while (count < size && m_subscriber.write(Stamped<MessageT>{messages[count], stamp})) {
+      ++count;
+    }
+    return count;
+  }
+
+  /** Messages are trivially copyable, so moved messages are copied. */
+  using ISubscriber<MessageT>::write;
+
+ private:
+  /** Queue of stamped messages. */
+  Subscriber<Stamped<MessageT>> m_subscriber;
+
+  /** Writer of record file. */
+  RecordWriter m_writer;
+
+  /** Number of messages, which could not be appended. */
+  std::atomic<uint64_t> m_lost{0};
+};
+
+/**
+ * Replays messages recorded by a Recorder to a Publisher.
+ * Messages are published either with their original timing or as fast as possible, e.g. to test
+ * loops offline at many times real time.
+ * @tparam MessageT Type of pubsub message, needs to be trivially copyable.
+ */
+template <typename MessageT>
+class Replayer {
+  static_assert(std::is_trivially_copyable_v<MessageT>, "Message needs to be trivially copyable.");
+
+ public:
+  /** Timing of replayed messages. */
+  enum class Timing {
+    /** Keep time between messages as recorded. */
+    ORIGINAL,
+    /** Publish messages without waiting. */
+    AS_FAST_AS_POSSIBLE
+  };
+
+  /**
+   * Create replayer, the file is opened by open().
+   * @param path Path of record file.
+   */
+  explicit Replayer(const std::string& path) : m_reader(path, sizeof(Stamped<MessageT>)) {}
+
+  /**
+   * Open record file.
+   * @return true on success, false if file does not exist or was recorded for another type.
+   */
+  bool open() {
+    return m_reader.open();
+  }
+
+  /**
+   * Get number of recorded messages.
+   * @return Number of messages.
+   */
+  uint64_t getCount() const {
+    return m_reader.getCount();
+  }
+
+  /**
+   * Get recorded message.
+   * @param index Index of message, less than getCount().
+   * @return Stamped message.
+   */
+  Stamped<MessageT> get(uint64_t index) const {
+    Stamped<MessageT> record;
+    std::memcpy(&record, m_reader.get(index), sizeof(record));
+    return record;
+  }
+
+  /**
+   * Publish all recorded messages, blocks until the last message was published.
+   * @param publisher Publisher to write messages to.
+   * @param timing Timing of messages.
+   * @return Number of messages, which could be written to all subscribers.
+   */
+  uint64_t replay(Publisher<MessageT>& publisher, Timing timing = Timing::ORIGINAL) const;
+
+ private:
+  /** Reader of record file. */
+  RecordReader m_reader;
+};
+
+template <typename MessageT>
+uint64_t Replayer<MessageT>::replay(Publisher<MessageT>& publisher, Timing timing) const {
+  const auto start = std::chrono::steady_clock::now();
+  std::chrono::steady_clock::time_point first_stamp{};
+  uint64_t count = 0;
+  for (uint64_t index = 0; index < getCount(); ++index) {
+    const Stamped<MessageT> record = get(index);
+    if (index == 0) {
+      first_stamp = record.stamp;
+    }
+    if (timing == Timing::ORIGINAL) {
+      std::this_thread::sleep_until(start + (record.stamp - first_stamp));
+    }
+    count += publisher.write(record.message) ? 1 : 0;
+  }
+  return count;
+}
+
+}  // namespace fdl
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <boost/lockfree/queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace fdl {
+
+template <typename MessageT>
+class SamplePool;
+
+/**
+ * Reference counted handle to a message slot of a SamplePool.
+ * Copying a sample only increments the reference counter, the message itself is shared. The slot is
+ * returned to its pool as soon as the last handle is destroyed. Samples are used as message type of
+ * publishers and subscribers (Publisher<Sample<MessageT>>) for zero copy publishing.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class Sample {
+ public:
+  Sample() = default;
+
+  Sample(const Sample& other) : m_pool(other.m_pool), m_index(other.m_index) {
+    acquire();
+  }
+
+  Sample(Sample&& other) noexcept : m_pool(other.m_pool), m_index(other.m_index) {
+    other.m_pool = nullptr;
+  }
+
+  Sample& operator=(const Sample& other) {
+    if (this != &other) {
+      other.acquire();
+      release();
+      m_pool = other.m_pool;
+      m_index = other.m_index;
+    }
+    return *this;
+  }
+
+  Sample& operator=(Sample&& other) noexcept {
+    if (this != &other) {
+      release();
+      m_pool = other.m_pool;
+      m_index = other.m_index;
+      other.m_pool = nullptr;
+    }
+    return *this;
+  }
+
+  ~Sample() {
+    release();
+  }
+
+  /**
+   * Get validity state of sample.
+   * @return true if sample references a message slot.
+   */
+  explicit operator bool() const {
+    return m_pool != nullptr;
+  }
+
+  /** Access referenced message. */
+  MessageT& operator*() const {
+    EXPECT(m_pool != nullptr, "Sample is empty.");
+    return m_pool->message(m_index);
+  }
+
+  /** Access referenced message. */
+  MessageT* operator->() const {
+    return &**this;
+  }
+
+ private:
+  friend class SamplePool<MessageT>;
+
+  /** Create sample, which takes over already acquired slot of pool. */
+  Sample(SamplePool<MessageT>* pool, size_t index) : m_pool(pool), m_index(index) {}
+
+  void acquire() const {
+    if (m_pool != nullptr) {
+      m_pool->acquire(m_index);
+    }
+  }
+
+  void release() {
+    if (m_pool != nullptr) {
+      m_pool->release(m_index);
+      m_pool = nullptr;
+    }
+  }
+
+  /** Pool owning the referenced message slot. */
+  SamplePool<MessageT>* m_pool{nullptr};
+
+  /** Index of referenced message slot. */
+  size_t m_index{0};
+};
+
+/**
+ * Pool of preallocated messages for zero copy publishing.
+ * A publisher loans a free message slot, fills it in place and publishes the returned sample
+ * handle. Subscribers receive handles to the same memory, so the message is never copied. Loaning
+ * and releasing is thread safe and lock free and does not allocate memory. The pool needs to
+ * outlive all loaned samples.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class SamplePool {
+ public:
+  /**
+   * Create pool, all message slots are allocated on creation.
+   * @param capacity Number of message slots. Needs to cover all samples which are hold in
+   *        subscriber queues and by readers at the same time.
+   */
+  explicit SamplePool(size_t capacity);
+
+  SamplePool(const SamplePool&) = delete;
+  SamplePool(SamplePool&&) = delete;
+  SamplePool& operator=(SamplePool&&) = delete;
+  SamplePool& operator=(const SamplePool&) = delete;
+
+  ~SamplePool() = default;
+
+  /**
+   * Loan a free message slot.
+   * The message keeps the content of its previous usage and needs to be filled completely.
+   * @return Sample handle, which is empty if no slot is available.
+   */
+  Sample<MessageT> loan();
+
+  /**
+   * Get number of available message slots.
+   * Value is only a snapshot, if samples are loaned or released concurrently.
+   * @return Number of message slots which can be loaned.
+   */
+  size_t available() const {
+    return m_available.load(std::memory_order_relaxed);
+  }
+
+ private:
+  friend class Sample<MessageT>;
+
+  /** Preallocated message with reference counter. */
+  struct Slot {
+    MessageT message{};
+    std::atomic<size_t> references{0};
+  };
+
+  MessageT& message(size_t index) {
+    return m_slots[index].message;
+  }
+
+  void acquire(size_t index) {
+    m_slots[index].references.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void release(size_t index);
+
+  /** Message slots. */
+  std::unique_ptr<Slot[]> m_slots{};
+
+  /** Indices of all free message slots. */
+  boost::lockfree::queue<size_t> m_free_slots;
+
+  /** Number of free message slots. */
+  std::atomic<size_t> m_available{0};
+};
+
+template <typename MessageT>
+SamplePool<MessageT>::SamplePool(size_t capacity)
+    : m_slots(std::make_unique<Slot[]>(capacity)), m_free_slots(capacity), m_available(capacity) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+  for (size_t index = 0; index < capacity; ++index) {
+    ENSURE(m_free_slots.bounded_push(index));
+  }
+}
+
+template <typename MessageT>
+Sample<MessageT> SamplePool<MessageT>::loan() {
+  size_t index{0};
+  if (!m_free_slots.pop(index)) {
+    return Sample<MessageT>();
+  }
+  m_available.fetch_sub(1, std::memory_order_relaxed);
+  m_slots[index].references.store(1, std::memory_order_relaxed);
+  return Sample<MessageT>(this, index);
+}
+
+template <typename MessageT>
+void SamplePool<MessageT>::release(size_t index) {
+  // last reader returns the slot, acquire pairs with writes of other sample owners
+  if (m_slots[index].references.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    // can't fail, queue capacity covers all slots
+    m_free_slots.bounded_push(index);
+    m_available.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+}  // namespace fdl
@@ -0,0 +1,85 @@
+#include "SharedMemory.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <contract/contract_assert.hpp>
+
+namespace fdl {
+
+SharedMemory::SharedMemory(const std::string& name, size_t size, mode_t mode)
+    : m_name(name), m_size(size), m_mode(mode) {
+  EXPECT(name.size() > 1 && name[0] == '/' && name.find('/', 1) == std::string::npos,
+         "Name needs to start with a single slash.");
+  EXPECT(size > 0, "Size must be greater 0.");
+}
+
+SharedMemory::~SharedMemory() {
+  close();
+}
+
+bool SharedMemory::create() {
+  close();
+  ::shm_unlink(m_name.c_str());
+  const int fd = ::shm_open(m_name.c_str(), O_RDWR | O_CREAT | O_EXCL, m_mode);
+  if (fd < 0) {
+    return false;
+  }
+  // shm_open() masks the mode with the umask
+  struct stat status {};
+  if (::fchmod(fd, m_mode) != 0 || ::ftruncate(fd, static_cast<off_t>(m_size)) != 0 ||
+      ::fstat(fd, &status) != 0 || !map(fd)) {
+    ::close(fd);
+    ::shm_unlink(m_name.c_str());
+    return false;
+  }
+  ::close(fd);
+  m_inode = status.st_ino;
+  m_is_creator = true;
+  return true;
+}
+
+bool SharedMemory::open() {
+  close();
+  const int fd = ::shm_open(m_name.c_str(), O_RDWR, 0);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat status {};
+  const bool success =
+      ::fstat(fd, &status) == 0 && static_cast<size_t>(status.st_size) >= m_size && map(fd);
+  ::close(fd);
+  return success;
+}
+
+void SharedMemory::close() {
+  if (m_data != nullptr) {
+    ::munmap(m_data, m_size);
+    m_data = nullptr;
+  }
+  if (m_is_creator) {
+    // only remove name if it still refers to the created segment
+    const int fd = ::shm_open(m_name.c_str(), O_RDONLY, 0);
+    if (fd >= 0) {
+      struct stat status {};
+      if (::fstat(fd, &status) == 0 && status.st_ino == m_inode) {
+        ::shm_unlink(m_name.c_str());
+      }
+      ::close(fd);
+    }
+    m_is_creator = false;
+  }
+}
+
+bool SharedMemory::map(int fd) {
+  void* data = ::mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd, 0);
+  if (data == MAP_FAILED) {  // NOLINT
+    return false;
+  }
+  m_data = data;
+  return true;
+}
+
+}  // namespace fdl
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#include <cstddef>
+#include <string>
+
+namespace fdl {
+
+/**
+ * Named POSIX shared memory segment mapped into the address space of the process.
+ * One process creates the segment, other processes open it by name. The creator removes the name
+ * on close, unless the name was taken over by a newer segment in the meantime. Processes which
+ * still map the segment keep using it until they close it as well.
+ * The creator sets the access mode of the segment, processes of other users can only open the
+ * segment, if the mode grants them read and write access.
+ * Mapping allocates memory, so create() and open() must not be called by realtime threads.
+ */
+class SharedMemory {
+ public:
+  /**
+   * Create shared memory object, no segment is mapped yet.
+   * @param name Name of segment, needs to start with '/' and must not contain further slashes.
+   * @param size Size of segment in Byte.
+   * @param mode Access mode of created segment, not masked by the umask of the process.
+   */
+  SharedMemory(const std::string& name, size_t size, mode_t mode = S_IRUSR | S_IWUSR);
+
+  SharedMemory(const SharedMemory&) = delete;
+  SharedMemory(SharedMemory&&) = delete;
+  SharedMemory& operator=(SharedMemory&&) = delete;
+  SharedMemory& operator=(const SharedMemory&) = delete;
+
+  ~SharedMemory();
+
+  /**
+   * Create new zero filled segment and map it, replacing a stale segment of the same name.
+   * Pages are populated on creation, so accesses won't cause page faults.
+   * @return true on success.
+   */
+  bool create();
+
+  /**
+   * Open and map an existing segment.
+   * @return true on success, false if segment does not exist or is too small.
+   */
+  bool open();
+
+  /**
+   * Unmap segment, the creator removes the name of the segment too.
+   */
+  void close();
+
+  /**
+   * Get name of segment.
+   * @return Name of segment.
+   */
+  const std::string& getName() const {
+    return m_name;
+  }
+
+  /**
+   * Get size of segment.
+   * @return Size of segment in Byte.
+   */
+  size_t getSize() const {
+    return m_size;
+  }
+
+  /**
+   * Get mapped segment.
+   * @return Start of mapped segment, nullptr if not mapped.
+   */
+  void* getData() const {
+    return m_data;
+  }
+
+ private:
+  /** Map segment of opened file descriptor. */
+  bool map(int fd);
+
+  /** Name of segment. */
+  const std::string m_name{};
+
+  /** Size of segment. */
+  const size_t m_size{0};
+
+  /** Access mode of created segment. */
+  const mode_t m_mode{0};
+
+  /** Mapped segment. */
+  void* m_data{nullptr};
+
+  /** true if segment was created by this object. */
+  bool m_is_creator{false};
+
+  /** Inode of created segment, identifies the segment behind the name. */
+  ino_t m_inode{0};
+};
+
+}  // namespace fdl
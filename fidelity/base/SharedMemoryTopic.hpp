@@ -0,0 +1,397 @@
+#pragma once
+
+#include <sys/stat.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <string>
+#include <type_traits>
+
+#include "Futex.hpp"
+#include "SharedMemory.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Header of a single producer single consumer ring in shared memory, messages follow the header.
+ * Read and write positions are placed on separate cache lines. The waiting flag tells the sender
+ * to wake a sleeping receiver with the futex signal word, otherwise no system call is needed.
+ */
+struct SharedMemoryRing {
+  /** Marks an initialized ring. */
+  static constexpr uint64_t MAGIC = 0x666964656c697479;
+
+  /**
+   * Set by the sender after the ring was initialized, cleared when the sender closes or replaces
+   * the segment, so attached receivers detect that the ring is no longer written.
+   */
+  std::atomic<uint64_t> magic{0};
+
+  /** Size of messages, checked by the receiver. */
+  uint64_t message_size{0};
+
+  /** Number of messages in the ring, checked by the receiver. */
+  uint64_t capacity{0};
+
+  /** Write position, only written by sender. */
+  alignas(64) std::atomic<uint64_t> head{0};
+
+  /** Read position, only written by receiver. */
+  alignas(64) std::atomic<uint64_t> tail{0};
+
+  /** Futex word, incremented by sender to wake the receiver. */
+  alignas(64) std::atomic<uint32_t> signal{0};
+
+  /** Set by receiver before sleeping, cleared by the sender which wakes the receiver. */
+  std::atomic<uint32_t> waiting{0};
+};
+
+/**
+ * Sending part of inter process communication over shared memory.
+ * The sender is subscribed to a Publisher like any Subscriber and copies each message into a ring
+ * in shared memory, which is read by a SharedMemoryReceiver in another process. Writes neither
+ * lock nor allocate memory and do a system call only if the receiver sleeps in wait().
+ * The sender creates the shared memory segment and removes it on destruction. An existing segment
+ * of the same name is invalidated before it is replaced, so receivers still attached to it detect
+ * the lost connection instead of reading a dead ring. Receivers running under another user need
+ * read and write access granted by the mode of the segment, e.g. S_IRGRP | S_IWGRP for a shared
+ * group.
+ * @tparam MessageT Type of pubsub message, needs to be trivially copyable.
+ */
+template <typename MessageT>
+class SharedMemorySender : public ISubscriber<MessageT> {
+  static_assert(std::is_trivially_copyable_v<MessageT>, "Message needs to be trivially copyable.");
+  static_assert(alignof(MessageT) <= alignof(SharedMemoryRing), "Message alignment too large.");
+
+ public:
+  /**
+   * Create sender, the shared memory segment is created by open().
+   * @param name Name of shared memory segment and subscriber, needs to start with '/'.
+   * @param capacity Number of messages in ring.
+   * @param mode Access mode of shared memory segment, default is access by the same user only.
+   */
+  SharedMemorySender(const std::string& name, size_t capacity, mode_t mode = S_IRUSR | S_IWUSR);
+
+  SharedMemorySender(const SharedMemorySender&) = delete;
+  SharedMemorySender(SharedMemorySender&&) = delete;
+  SharedMemorySender& operator=(SharedMemorySender&&) = delete;
+  SharedMemorySender& operator=(const SharedMemorySender&) = delete;
+
+  /** Invalidate ring for attached receivers and remove segment. */
+  ~SharedMemorySender() override;
+
+  /**
+   * Get name of subscriber.
+   * @return name Name of subscriber.
+   */
+  const std::string& getName() const override {
+    return m_shared_memory.getName();
+  }
+
+  /**
+   * Create shared memory segment and initialize ring.
+   * Allocates memory, so must not be called by realtime threads.
+   * @return true on success.
+   */
+  bool open();
+
+  /**
+   * Write message to shared memory ring.
+   * @param message Message data to be written.
+   * @return true if message could be written, false if ring is full or not open.
+   */
+  bool write(const MessageT& message) override;
+
+  /**
+   * Write batch of messages to shared memory ring.
+   * The write position is published once and the receiver is woken up at most once.
+   * @param messages Messages to be written.
+   * @param size Number of messages.
+   * @return Number of written messages, less than size if ring got full.
+   */
+  size_t write(const MessageT* messages, size_t size) override;
+
+  /** Messages are trivially copyable, so moved messages are copied. */
+  using ISubscriber<MessageT>::write;
+
+ private:
+  /** Clear magic of ring and wake receiver, so it detects the lost connection. */
+  static void invalidate(SharedMemoryRing* ring);
+
+  /** Capacity of ring. */
+  const size_t m_capacity{0};
+
+  /** Shared memory segment containing the ring. */
+  SharedMemory m_shared_memory;
+
+  /** Ring in shared memory segment. */
+  SharedMemoryRing* m_ring{nullptr};
+
+  /** Messages in shared memory segment. */
+  MessageT* m_messages{nullptr};
+};
+
+/**
+ * Receiving part of inter process communication over shared memory.
+ * Reads messages written by a SharedMemorySender in another process. Reads neither lock nor
+ * allocate memory, wait() sleeps on a futex until new messages arrive. If the sender closes or
+ * replaces the segment, the receiver detaches after reading the remaining messages and
+ * isConnected() returns false, open() can be called again to attach to a new segment.
+ *
+ * @note The receiver is no ISubscriber and can't wake a Loop, because a loop thread can't sleep on
+ * the futex of the ring. Loops either poll read() periodically or a non realtime loop blocks in
+ * wait() and forwards the messages to a local Publisher.
+ * @tparam MessageT Type of pubsub message, needs to be trivially copyable.
+ */
+template <typename MessageT>
+class SharedMemoryReceiver {
+  static_assert(std::is_trivially_copyable_v<MessageT>, "Message needs to be trivially copyable.");
+  static_assert(alignof(MessageT) <= alignof(SharedMemoryRing), "Message alignment too large.");
+
+ public:
+  /**
+   * Create receiver, the shared memory segment is opened by open().
+   * @param name Name of shared memory segment, needs to start with '/'.
+   * @param capacity Number of messages in ring, needs to match capacity of sender.
+   */
+  SharedMemoryReceiver(const std::string& name, size_t capacity);
+
+  SharedMemoryReceiver(const SharedMemoryReceiver&) = delete;
+  SharedMemoryReceiver(SharedMemoryReceiver&&) = delete;
+  SharedMemoryReceiver& operator=(SharedMemoryReceiver&&) = delete;
+  SharedMemoryReceiver& operator=(const SharedMemoryReceiver&) = delete;
+
+  ~SharedMemoryReceiver() = default;
+
+  /**
+   * Open shared memory segment created by sender.
+   * Allocates memory, so must not be called by realtime threads.
+   * @return true on success, false if sender did not create a matching ring yet.
+   */
+  bool open();
+
+  /**
+   * Get connection state of receiver.
+   * @return true if receiver is attached to a ring, which is still written by the sender.
+   */
+  bool isConnected() const {
+    return m_ring != nullptr;
+  }
+
+  /**
+   * Read received message into an output variable.
+   * @param message Contains read data, if new data was received.
+   * @return true if new data was successfully read, false if no data was received.
+   */
+  bool read(MessageT& message);
+
+  /**
+   * Read batch of received messages into an output buffer.
+   * @param messages Output buffer for read messages.
+   * @param size Size of output buffer.
+   * @return Number of read messages.
+   */
+  size_t read(MessageT* messages, size_t size);
+
+  /**
+   * Wait until messages are available for reading.
+   * @param timeout Maximal duration to wait.
+   * @return true if messages are available, false on timeout or if not connected.
+   */
+  bool wait(std::chrono::nanoseconds timeout);
+
+ private:
+  /** Number of messages available for reading. */
+  uint64_t available() const {
+    return m_ring->head.load(std::memory_order_acquire) -
+           m_ring->tail.load(std::memory_order_relaxed);
+  }
+
+  /** Detach from ring, if sender invalidated it, returns true if still connected. */
+  bool checkConnection();
+
+  /** Capacity of ring. */
+  const size_t m_capacity{0};
+
+  /** Shared memory segment containing the ring. */
+  SharedMemory m_shared_memory;
+
+  /** Ring in shared memory segment. */
+  SharedMemoryRing* m_ring{nullptr};
+
+  /** Messages in shared memory segment. */
+  const MessageT* m_messages{nullptr};
+};
+
+template <typename MessageT>
+SharedMemorySender<MessageT>::SharedMemorySender(const std::string& name, size_t capacity,
+                                                 mode_t mode)
+    : m_capacity(capacity),
+      m_shared_memory(name, sizeof(SharedMemoryRing) + capacity * sizeof(MessageT), mode) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+}
+
+template <typename MessageT>
+SharedMemorySender<MessageT>::~SharedMemorySender() {
+  invalidate(m_ring);
+}
+
+template <typename MessageT>
+void SharedMemorySender<MessageT>::invalidate(SharedMemoryRing* ring) {
+  if (ring == nullptr) {
+    return;
+  }
+  ring->magic.store(0, std::memory_order_release);
+  ring->signal.fetch_add(1, std::memory_order_release);
+  futex::wake(ring->signal, INT_MAX, true);
+}
+
+template <typename MessageT>
+bool SharedMemorySender<MessageT>::open() {
+  invalidate(m_ring);
+  m_ring = nullptr;
+  // invalidate segment of a previous sender, which is replaced by create()
+  SharedMemory previous(m_shared_memory.getName(), sizeof(SharedMemoryRing));
+  if (previous.open()) {
+    auto* ring = static_cast<SharedMemoryRing*>(previous.getData());
+    if (ring->magic.load(std::memory_order_acquire) == SharedMemoryRing::MAGIC) {
+      invalidate(ring);
+    }
+  }
+  if (!m_shared_memory.create()) {
+    return false;
+  }
+  auto* ring = new (m_shared_memory.getData()) SharedMemoryRing();
+  ring->message_size = sizeof(MessageT);
+  ring->capacity = m_capacity;
+  ring->magic.store(SharedMemoryRing::MAGIC, std::memory_order_release);
+
+  m_messages = reinterpret_cast<MessageT*>(ring + 1);  // NOLINT
+  m_ring = ring;
+  return true;
+}
+
+template <typename MessageT>
+bool SharedMemorySender<MessageT>::write(const MessageT& message) {
+  return write(&message, 1) == 1;
+}
+
+template <typename MessageT>
+size_t SharedMemorySender<MessageT>::write(const MessageT* messages, size_t size) {
+  if (m_ring == nullptr) {
+    return 0;
+  }
+  const uint64_t head = m_ring->head.load(std::memory_order_relaxed);
+  const uint64_t available = m_capacity - (head - m_ring->tail.load(std::memory_order_acquire));
+  const size_t count = size < available ? size : available;
+  for (size_t index = 0; index < count; ++index) {
+    m_messages[(head + index) % m_capacity] = messages[index];  // NOLINT
+  }
+  m_ring->head.store(head + count, std::memory_order_release);
+
+  // pairs with fence in SharedMemoryReceiver::wait()
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  // the sender clears the flag itself, so a receiver killed in wait() doesn't leave it set, a
+  // waiting receiver sets it again before sleeping
+  if (count > 0 && m_ring->waiting.load(std::memory_order_relaxed) != 0 &&
+      m_ring->waiting.exchange(0, std::memory_order_relaxed) != 0) {
+    m_ring->signal.fetch_add(1, std::memory_order_release);
+    futex::wake(m_ring->signal, 1, true);
+  }
+  return count;
+}
+
+template <typename MessageT>
+SharedMemoryReceiver<MessageT>::SharedMemoryReceiver(const std::string& name, size_t capacity)
+    : m_capacity(capacity),
+      m_shared_memory(name, sizeof(SharedMemoryRing) + capacity * sizeof(MessageT)) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+}
+
+template <typename MessageT>
+bool SharedMemoryReceiver<MessageT>::open() {
+  m_ring = nullptr;
+  if (!m_shared_memory.open()) {
+    return false;
+  }
+  auto* ring = static_cast<SharedMemoryRing*>(m_shared_memory.getData());
+  if (ring->magic.load(std::memory_order_acquire) != SharedMemoryRing::MAGIC ||
+      ring->message_size != sizeof(MessageT) || ring->capacity != m_capacity) {
+    m_shared_memory.close();
+    return false;
+  }
+  m_messages = reinterpret_cast<const MessageT*>(ring + 1);  // NOLINT
+  m_ring = ring;
+  return true;
+}
+
+template <typename MessageT>
+bool SharedMemoryReceiver<MessageT>::read(MessageT& message) {
+  return read(&message, 1) == 1;
+}
+
+template <typename MessageT>
+size_t SharedMemoryReceiver<MessageT>::read(MessageT* messages, size_t size) {
+  if (m_ring == nullptr) {
+    return 0;
+  }
+  const uint64_t tail = m_ring->tail.load(std::memory_order_relaxed);
+  const uint64_t available = m_ring->head.load(std::memory_order_acquire) - tail;
+  const size_t count = size < available ? size : available;
+  if (count == 0) {
+    checkConnection();
+    return 0;
+  }
+  for (size_t index = 0; index < count; ++index) {
+    messages[index] = m_messages[(tail + index) % m_capacity];  // NOLINT
+  }
+  m_ring->tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT>
+bool SharedMemoryReceiver<MessageT>::checkConnection() {
+  if (m_ring->magic.load(std::memory_order_acquire) == SharedMemoryRing::MAGIC ||
+      available() > 0) {
+    return true;
+  }
+  m_ring = nullptr;
+  m_messages = nullptr;
+  m_shared_memory.close();
+  return false;
+}
+
+template <typename MessageT>
+bool SharedMemoryReceiver<MessageT>::wait(std::chrono::nanoseconds timeout) {
+  if (m_ring == nullptr) {
+    return false;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (available() == 0) {
+    // load signal before checking the connection, so an invalidation can't be missed
+    const uint32_t signal = m_ring->signal.load(std::memory_order_acquire);
+    if (!checkConnection()) {
+      return false;
+    }
+    m_ring->waiting.store(1, std::memory_order_relaxed);
+    // either the sender sees the waiting flag or the receiver sees the new messages
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (available() == 0) {
+      futex::waitFor(m_ring->signal, signal, deadline - std::chrono::steady_clock::now(), true);
+    }
+    m_ring->waiting.store(0, std::memory_order_relaxed);
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return available() > 0;
+    }
+  }
+  return true;
+}
+
+}  // namespace fdl
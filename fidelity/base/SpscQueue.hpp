@@ -0,0 +1,293 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Copy.hpp"
+
+namespace fdl {
+
+/**
+ * Bounded lock free single producer single consumer queue.
+ * Producer and consumer each keep their position together with a cached copy of the other position
+ * on their own cache line. The other position is only reloaded if the cached copy reports the
+ * queue full or empty, so the cache lines are not transferred between cores on every message.
+ * Batch operations publish their position once for the whole batch. All slots are allocated on
+ * creation. Interface follows boost::lockfree::spsc_queue for use as queue type of Subscriber.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+class SpscQueue {
+ public:
+  using value_type = MessageT;
+
+  /**
+   * Create queue, all slots are allocated on creation.
+   * @param capacity Number of messages, which can be stored.
+   */
+  explicit SpscQueue(size_t capacity);
+
+  SpscQueue(const SpscQueue&) = delete;
+  SpscQueue(SpscQueue&&) = delete;
+  SpscQueue& operator=(SpscQueue&&) = delete;
+  SpscQueue& operator=(const SpscQueue&) = delete;
+
+  ~SpscQueue();
+
+  /**
+   * Push message to queue.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(const MessageT& message);
+
+  /**
+   * Move message into queue.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(MessageT&& message);
+
+  /**
+   * Construct message in place in queue.
+   * Must only be called by the producer.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return true if message was pushed, false if queue is full.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args);
+
+  /**
+   * Push batch of messages to queue.
+   * The write position is published once for the whole batch.
+   * Must only be called by the producer.
+   * @param messages Messages to push.
+   * @param size Number of messages.
+   * @return Number of pushed messages.
+   */
+  size_t push(const MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message from queue.
+   * Must only be called by the consumer.
+   * @param message Contains popped message on success.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  bool pop(MessageT& message);
+
+  /**
+   * Pop batch of messages from queue.
+   * The read position is published once for the whole batch.
+   * Must only be called by the consumer.
+   * @param messages Output buffer for popped messages.
+   * @param size Size of output buffer.
+   * @return Number of popped messages.
+   */
+  size_t pop(MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message and call functor for it.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(MessageT&).
+   * @param functor Functor called for the message.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  template <typename FunctorT>
+  bool consume_one(const FunctorT& functor);
+
+  /**
+   * Pop all messages and call functor for each of them.
+   * The read position is published once after all messages were handled.
+   * Must only be called by the consumer.
+   * @tparam FunctorT Callable with signature void(const MessageT&).
+   * @param functor Functor called for each message.
+   * @return Number of popped messages.
+   */
+  template <typename FunctorT>
+  size_t consume_all(const FunctorT& functor);
+
+  /**
+   * Get number of messages in queue.
+   * @return Number of messages available for reading.
+   */
+  size_t read_available() const {
+    return distance(m_tail.load(std::memory_order_acquire), m_head.load(std::memory_order_acquire));
+  }
+
+  /**
+   * Get number of messages in queue, sampled whenever the consumer reloaded the write position.
+   * Only reads consumer state, so it doesn't transfer the cache line of the producer like
+   * read_available(). Must only be called by the consumer.
+   * @return Number of messages, which the consumer found on the last reload of the write position.
+   */
+  size_t read_level() const {
+    return m_read_level;
+  }
+
+ private:
+  using Slot = typename std::aligned_storage<sizeof(MessageT), alignof(MessageT)>::type;
+
+  /** Get message storage of slot index. */
+  MessageT* slot(size_t index) {
+    return std::launder(reinterpret_cast<MessageT*>(&m_slots[index]));  // NOLINT
+  }
+
+  /** Get slot index following index. */
+  size_t next(size_t index) const {
+    return index + 1 == m_size ? 0 : index + 1;
+  }
+
+  /** Get number of slots from index from to index to. */
+  size_t distance(size_t from, size_t to) const {
+    return to >= from ? to - from : to + m_size - from;
+  }
+
+  /** Number of slots, one slot is kept free to distinguish a full from an empty queue. */
+  const size_t m_size{0};
+
+  /** Message storage, messages are constructed on push and destroyed on pop. */
+  std::unique_ptr<Slot[]> m_slots{};
+
+  /** Write position, only written by producer. */
+  alignas(64) std::atomic<size_t> m_head{0};
+
+  /** Read position last seen by producer. */
+  size_t m_cached_tail{0};
+
+  /** Read position, only written by consumer. */
+  alignas(64) std::atomic<size_t> m_tail{0};
+
+  /** Write position last seen by consumer. */
+  size_t m_cached_head{0};
+
+  /** Number of queued messages on last reload of write position by consumer. */
+  size_t m_read_level{0};
+};
+
+template <typename MessageT>
+SpscQueue<MessageT>::SpscQueue(size_t capacity)
+    : m_size(capacity + 1), m_slots(std::make_unique<Slot[]>(capacity + 1)) {
+  EXPECT(capacity > 0, "Capacity must be greater 0.");
+}
+
+template <typename MessageT>
+SpscQueue<MessageT>::~SpscQueue() {
+  consume_all([](const MessageT& /*message*/) {});
+}
+
+template <typename MessageT>
+bool SpscQueue<MessageT>::push(const MessageT& message) {
+  return emplace(message);
+}
+
+template <typename MessageT>
+bool SpscQueue<MessageT>::push(MessageT&& message) {
+  return emplace(std::move(message));
+}
+
+template <typename MessageT>
+template <typename... ArgsT>
+bool SpscQueue<MessageT>::emplace(ArgsT&&... args) {
+  const size_t head = m_head.load(std::memory_order_relaxed);
+  const size_t next_head = next(head);
+  if (next_head == m_cached_tail) {
+    m_cached_tail = m_tail.load(std::memory_order_acquire);
+    if (next_head == m_cached_tail) {
+      return false;
+    }
+  }
+  copy::construct(slot(head), std::forward<ArgsT>(args)...);
+  m_head.store(next_head, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+size_t SpscQueue<MessageT>::push(const MessageT* messages, size_t size) {
+  const size_t head = m_head.load(std::memory_order_relaxed);
+  size_t available = m_size - 1 - distance(m_cached_tail, head);
+  if (available < size) {
+    m_cached_tail = m_tail.load(std::memory_order_acquire);
+    available = m_size - 1 - distance(m_cached_tail, head);
+  }
+  const size_t count = size < available ? size : available;
+  size_t index = head;
+  for (size_t message = 0; message < count; ++message) {
+    copy::construct(slot(index), messages[message]);
+    index = next(index);
+  }
+  m_head.store(index, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT>
+bool SpscQueue<MessageT>::pop(MessageT& message) {
+  return consume_one([&message](MessageT& queued) { message = std::move(queued); });
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+bool SpscQueue<MessageT>::consume_one(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  if (tail == m_cached_head) {
+    m_cached_head = m_head.load(std::memory_order_acquire);
+    m_read_level = distance(tail, m_cached_head);
+    if (tail == m_cached_head) {
+      return false;
+    }
+  }
+  MessageT* message = slot(tail);
+  functor(*message);
+  message->~MessageT();
+  m_tail.store(next(tail), std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT>
+size_t SpscQueue<MessageT>::pop(MessageT* messages, size_t size) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  size_t available = distance(tail, m_cached_head);
+  if (available < size) {
+    m_cached_head = m_head.load(std::memory_order_acquire);
+    available = distance(tail, m_cached_head);
+    m_read_level = available;
+  }
+  const size_t count = size < available ? size : available;
+  size_t index = tail;
+  for (size_t popped = 0; popped < count; ++popped) {
+    MessageT* message = slot(index);
+    messages[popped] = std::move(*message);  // NOLINT
+    message->~MessageT();
+    index = next(index);
+  }
+  m_tail.store(index, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT>
+template <typename FunctorT>
+size_t SpscQueue<MessageT>::consume_all(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  m_cached_head = m_head.load(std::memory_order_acquire);
+  const size_t count = distance(tail, m_cached_head);
+  m_read_level = count;
+  size_t index = tail;
+  for (size_t popped = 0; popped < count; ++popped) {
+    MessageT* message = slot(index);
+    functor(*message);
+    message->~MessageT();
+    index = next(index);
+  }
+  m_tail.store(index, std::memory_order_release);
+  return count;
+}
+
+}  // namespace fdl
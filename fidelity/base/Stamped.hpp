@@ -0,0 +1,30 @@
+#pragma once
+
+#include <chrono>
+#include <type_traits>
+
+namespace fdl {
+
+/**
+ * Envelope adding a publish time stamp to a message.
+ * Publishers of stamped messages set the stamp on write, subscribers record the latency between
+ * write and read into a LatencyHistogram (see Subscriber::setLatencyHistogram()).
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+struct Stamped {
+  /** Message data. */
+  MessageT message{};
+
+  /** Time of publishing, the default epoch marks an unstamped message. */
+  std::chrono::steady_clock::time_point stamp{};
+};
+
+/** Checks if a message type is a Stamped envelope. */
+template <typename MessageT>
+struct IsStamped : std::false_type {};
+
+template <typename MessageT>
+struct IsStamped<Stamped<MessageT>> : std::true_type {};
+
+}  // namespace fdl
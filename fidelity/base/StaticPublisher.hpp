@@ -0,0 +1,188 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Stamped.hpp"
+#include "Statistics.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Publisher with a fixed set of subscribers of one concrete type.
+ * Subscribers are added on configuration and kept in a flat array of plain pointers. Writes call
+ * the concrete subscriber type without virtual dispatch, so the fan out can be inlined and needs
+ * neither the epoch handling nor the shared pointer indirection of Publisher. Use Publisher if
+ * subscribers are added or removed at runtime or are of different types.
+ * @tparam MessageT Type of pubsub message.
+ * @tparam SubscriberT Concrete type of all subscribers.
+ */
+template <typename MessageT, typename SubscriberT = Subscriber<MessageT>>
+class StaticPublisher {
+ public:
+  /**
+   * Create publisher.
+   * @param name Name of publisher.
+   */
+  explicit StaticPublisher(const std::string& name);
+
+  StaticPublisher(const StaticPublisher&) = delete;
+  StaticPublisher(StaticPublisher&&) = delete;
+  StaticPublisher& operator=(StaticPublisher&&) = delete;
+  StaticPublisher& operator=(const StaticPublisher&) = delete;
+
+  ~StaticPublisher() = default;
+
+  /**
+   * Get name of publisher.
+   * @return name Name of publisher.
+   */
+  const std::string& getName() const {
+    return m_name;
+  }
+
+  /**
+   * Register new subscriber to publisher.
+   * Name of new subscriber needs to be unique for publisher. Subscribers can only be added before
+   * the first write, e.g. on configuration. Allocates memory, so must not be called by realtime
+   * threads.
+   * @param subscriber Subscriber which will be added.
+   * @return true on success, false otherwise.
+   */
+  bool subscribe(std::shared_ptr<SubscriberT> subscriber);
+
+  /**
+   * Publish data to subscribers.
+   * @param message Message data to publish.
+   * @return true if data could be written to all subscribers.
+   */
+  bool write(const MessageT& message);
+
+  /**
+   * Publish data to subscribers, moving it into the last subscriber.
+   * All other subscribers receive a copy.
+   * @param message Message data to publish.
+   * @return true if data could be written to all subscribers.
+   */
+  bool write(MessageT&& message);
+
+  /**
+   * Publish batch of messages to subscribers.
+   * Each subscriber receives the whole batch with a single write.
+   * @param messages Messages to publish.
+   * @param size Number of messages.
+   * @return true if all messages could be written to all subscribers.
+   */
+  bool write(const MessageT* messages, size_t size);
+
+  /**
+   * Get runtime statistics: published messages, messages which could not be written to all
+   * subscribers and time of last write. Can be called by any thread.
+   * @return Snapshot of statistics.
+   */
+  Statistics getStatistics() const {
+    return m_statistics.getStatistics();
+  }
+
+ private:
+  /** Mark publisher as written, stores only on the first write. */
+  void markWritten() {
+    if (!m_written.load(std::memory_order_relaxed)) {
+      m_written.store(true, std::memory_order_relaxed);
+    }
+  }
+
+  /** Name of publisher. */
+  const std::string m_name{};
+
+  /** Owners of subscribers. */
+  std::vector<std::shared_ptr<SubscriberT>> m_owners{};
+
+  /** Subscribers written by the publisher. */
+  std::vector<SubscriberT*> m_subscribers{};
+
+  /** Set on first write, subscribers can't be added afterwards. Read by subscribe(). */
+  std::atomic<bool> m_written{false};
+
+  /** Runtime statistics. */
+  StatisticsCounters m_statistics{};
+};
+
+template <typename MessageT, typename SubscriberT>
+StaticPublisher<MessageT, SubscriberT>::StaticPublisher(const std::string& name) : m_name(name) {
+  EXPECT(!name.empty(), "Publisher needs to be named.");
+}
+
+template <typename MessageT, typename SubscriberT>
+bool StaticPublisher<MessageT, SubscriberT>::subscribe(std::shared_ptr<SubscriberT> subscriber) {
+  EXPECT(!m_written.load(std::memory_order_relaxed),
+         "Subscribers need to be added before the first write.");
+  if (subscriber == nullptr || subscriber->getName().empty()) {
+    return false;
+  }
+  auto found_subscriber = std::find_if(m_subscribers.begin(), m_subscribers.end(),
+                                       [&](const SubscriberT* subscriber_it) {
+                                         return subscriber_it->getName() == subscriber->getName();
+                                       });
+  // subscriber already added
+  if (found_subscriber != m_subscribers.end()) {
+    return false;
+  }
+  m_subscribers.push_back(subscriber.get());
+  m_owners.push_back(std::move(subscriber));
+  return true;
+}
+
+template <typename MessageT, typename SubscriberT>
+bool StaticPublisher<MessageT, SubscriberT>::write(const MessageT& message) {
+  if constexpr (IsStamped<MessageT>::value) {
+    MessageT stamped_message = message;
+    return write(std::move(stamped_message));
+  }
+  markWritten();
+  bool success = true;
+  for (SubscriberT* subscriber : m_subscribers) {
+    success &= subscriber->SubscriberT::write(message);
+  }
+  m_statistics.recordPublish(success ? 1 : 0, 1);
+  return success;
+}
+
+template <typename MessageT, typename SubscriberT>
+bool StaticPublisher<MessageT, SubscriberT>::write(MessageT&& message) {
+  if constexpr (IsStamped<MessageT>::value) {
+    message.stamp = std::chrono::steady_clock::now();
+  }
+  markWritten();
+  bool success = true;
+  const size_t size = m_subscribers.size();
+  for (size_t index = 0; index + 1 < size; ++index) {
+    success &= m_subscribers[index]->SubscriberT::write(static_cast<const MessageT&>(message));
+  }
+  if (size > 0) {
+    success &= m_subscribers[size - 1]->SubscriberT::write(std::move(message));
+  }
+  m_statistics.recordPublish(success ? 1 : 0, 1);
+  return success;
+}
+
+template <typename MessageT, typename SubscriberT>
+bool StaticPublisher<MessageT, SubscriberT>::write(const MessageT* messages, size_t size) {
+  markWritten();
+  size_t written = size;
+  for (SubscriberT* subscriber : m_subscribers) {
+    written = std::min(written, subscriber->SubscriberT::write(messages, size));
+  }
+  m_statistics.recordPublish(written, size);
+  return written == size;
+}
+
+}  // namespace fdl
@@ -0,0 +1,237 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "Copy.hpp"
+
+namespace fdl {
+
+/**
+ * Lock free single producer single consumer queue with compile time capacity.
+ * Messages are stored inline, so the queue does not allocate memory and can be placed in static or
+ * locked memory. The capacity needs to be a power of two, so positions are mapped to slots by a
+ * mask. Read and write positions are placed on separate cache lines.
+ * Interface follows boost::lockfree::spsc_queue for use as queue type of Subscriber.
+ * @tparam MessageT Type of pubsub message.
+ * @tparam Capacity Number of messages, which can be stored.
+ */
+template <typename MessageT, size_t Capacity>
+class StaticQueue {
+  static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity needs to be a power of two.");
+
+ public:
+  using value_type = MessageT;
+
+  /**
+   * Create queue.
+   * @param capacity Capacity of queue, needs to match compile time capacity.
+   */
+  explicit StaticQueue(size_t capacity = Capacity);
+
+  StaticQueue(const StaticQueue&) = delete;
+  StaticQueue(StaticQueue&&) = delete;
+  StaticQueue& operator=(StaticQueue&&) = delete;
+  StaticQueue& operator=(const StaticQueue&) = delete;
+
+  ~StaticQueue();
+
+  /**
+   * Push message to queue.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(const MessageT& message);
+
+  /**
+   * Move message into queue.
+   * Must only be called by the producer.
+   * @param message Message to push.
+   * @return true if message was pushed, false if queue is full.
+   */
+  bool push(MessageT&& message);
+
+  /**
+   * Construct message in place in queue.
+   * Must only be called by the producer.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return true if message was pushed, false if queue is full.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args);
+
+  /**
+   * Push batch of messages to queue.
+   * The write position is published once for the whole batch.
+   * @param messages Messages to push.
+   * @param size Number of messages.
+   * @return Number of pushed messages.
+   */
+  size_t push(const MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message from queue.
+   * Must only be called by the consumer.
+   * @param message Contains popped message on success.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  bool pop(MessageT& message);
+
+  /**
+   * Pop batch of messages from queue.
+   * The read position is published once for the whole batch.
+   * @param messages Output buffer for popped messages.
+   * @param size Size of output buffer.
+   * @return Number of popped messages.
+   */
+  size_t pop(MessageT* messages, size_t size);
+
+  /**
+   * Pop oldest message and call functor for it.
+   * @tparam FunctorT Callable with signature void(MessageT&).
+   * @param functor Functor called for the message.
+   * @return true if a message was popped, false if queue is empty.
+   */
+  template <typename FunctorT>
+  bool consume_one(const FunctorT& functor);
+
+  /**
+   * Pop all messages and call functor for each of them.
+   * The read position is published once after all messages were handled.
+   * @tparam FunctorT Callable with signature void(const MessageT&).
+   * @param functor Functor called for each message.
+   * @return Number of popped messages.
+   */
+  template <typename FunctorT>
+  size_t consume_all(const FunctorT& functor);
+
+  /**
+   * Get number of messages in queue.
+   * @return Number of messages available for reading.
+   */
+  size_t read_available() const {
+    return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+  }
+
+ private:
+  /** Mask to map positions to slots. */
+  static constexpr size_t MASK = Capacity - 1;
+
+  MessageT* slot(size_t position) {
+    return std::launder(reinterpret_cast<MessageT*>(&m_slots[position & MASK]));  // NOLINT
+  }
+
+  /** Write position, only written by producer. */
+  alignas(64) std::atomic<size_t> m_head{0};
+
+  /** Read position, only written by consumer. */
+  alignas(64) std::atomic<size_t> m_tail{0};
+
+  /** Inline message storage, messages are constructed on push and destroyed on pop. */
+  alignas(64) typename std::aligned_storage<sizeof(MessageT), alignof(MessageT)>::type
+      m_slots[Capacity]{};
+};
+
+template <typename MessageT, size_t Capacity>
+StaticQueue<MessageT, Capacity>::StaticQueue(size_t capacity) {
+  EXPECT(capacity == Capacity, "Capacity must match compile time capacity.");
+}
+
+template <typename MessageT, size_t Capacity>
+StaticQueue<MessageT, Capacity>::~StaticQueue() {
+  const size_t head = m_head.load(std::memory_order_acquire);
+  for (size_t position = m_tail.load(std::memory_order_relaxed); position != head; ++position) {
+    slot(position)->~MessageT();
+  }
+}
+
+template <typename MessageT, size_t Capacity>
+bool StaticQueue<MessageT, Capacity>::push(const MessageT& message) {
+  return emplace(message);
+}
+
+template <typename MessageT, size_t Capacity>
+bool StaticQueue<MessageT, Capacity>::push(MessageT&& message) {
+  return emplace(std::move(message));
+}
+
+template <typename MessageT, size_t Capacity>
+template <typename... ArgsT>
+bool StaticQueue<MessageT, Capacity>::emplace(ArgsT&&... args) {
+  const size_t head = m_head.load(std::memory_order_relaxed);
+  if (head - m_tail.load(std::memory_order_acquire) == Capacity) {
+    return false;
+  }
+  copy::construct(slot(head), std::forward<ArgsT>(args)...);
+  m_head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT, size_t Capacity>
+size_t StaticQueue<MessageT, Capacity>::push(const MessageT* messages, size_t size) {
+  const size_t head = m_head.load(std::memory_order_relaxed);
+  const size_t available = Capacity - (head - m_tail.load(std::memory_order_acquire));
+  const size_t count = size < available ? size : available;
+  for (size_t index = 0; index < count; ++index) {
+    copy::construct(slot(head + index), messages[index]);
+  }
+  m_head.store(head + count, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT, size_t Capacity>
+bool StaticQueue<MessageT, Capacity>::pop(MessageT& message) {
+  return pop(&message, 1) == 1;
+}
+
+template <typename MessageT, size_t Capacity>
+template <typename FunctorT>
+bool StaticQueue<MessageT, Capacity>::consume_one(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  if (m_head.load(std::memory_order_acquire) == tail) {
+    return false;
+  }
+  MessageT* message = slot(tail);
+  functor(*message);
+  message->~MessageT();
+  m_tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename MessageT, size_t Capacity>
+size_t StaticQueue<MessageT, Capacity>::pop(MessageT* messages, size_t size) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  const size_t available = m_head.load(std::memory_order_acquire) - tail;
+  const size_t count = size < available ? size : available;
+  for (size_t index = 0; index < count; ++index) {
+    MessageT* message = slot(tail + index);
+    messages[index] = std::move(*message);  // NOLINT
+    message->~MessageT();
+  }
+  m_tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+template <typename MessageT, size_t Capacity>
+template <typename FunctorT>
+size_t StaticQueue<MessageT, Capacity>::consume_all(const FunctorT& functor) {
+  const size_t tail = m_tail.load(std::memory_order_relaxed);
+  const size_t count = m_head.load(std::memory_order_acquire) - tail;
+  for (size_t index = 0; index < count; ++index) {
+    MessageT* message = slot(tail + index);
+    functor(*message);
+    message->~MessageT();
+  }
+  m_tail.store(tail + count, std::memory_order_release);
+  return count;
+}
+
+}  // namespace fdl
@@ -0,0 +1,19 @@
+#include "Statistics.hpp"
+
+namespace fdl {
+
+Statistics StatisticsCounters::getStatistics() const {
+  Statistics statistics;
+  statistics.writes = m_writes.load(std::memory_order_relaxed);
+  statistics.drops = m_drops.load(std::memory_order_relaxed);
+  statistics.reads = m_reads.load(std::memory_order_relaxed);
+  statistics.high_water_mark = m_high_water_mark.load(std::memory_order_relaxed);
+  const auto last_write = m_last_write.load(std::memory_order_relaxed);
+  if (last_write != 0) {
+    statistics.last_write = std::chrono::steady_clock::time_point(
+        std::chrono::steady_clock::duration(last_write));
+  }
+  return statistics;
+}
+
+}  // namespace fdl
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace fdl {
+
+/**
+ * Statistics are recorded unless FDL_DISABLE_STATISTICS is defined, which removes all counter
+ * updates from the write and read paths.
+ */
+#ifdef FDL_DISABLE_STATISTICS
+constexpr bool STATISTICS_ENABLED = false;
+#else
+constexpr bool STATISTICS_ENABLED = true;
+#endif
+
+/** Snapshot of runtime statistics of a publisher or subscriber. */
+struct Statistics {
+  /** Number of written messages. */
+  uint64_t writes{0};
+
+  /** Number of messages, which could not be written (subscriber full) or were overwritten. */
+  uint64_t drops{0};
+
+  /** Number of read messages, subscribers only. */
+  uint64_t reads{0};
+
+  /** Maximal number of queued messages found by the reader, subscribers only. */
+  size_t high_water_mark{0};
+
+  /** Time of last write, publishers only, default constructed if nothing was written yet. */
+  std::chrono::steady_clock::time_point last_write{};
+};
+
+/**
+ * Runtime statistics counters of a publisher or subscriber.
+ * Counters are relaxed atomics, so recording neither locks nor orders memory. Counters written
+ * by producers and by the consumer are placed on separate cache lines, so they don't bounce
+ * between writing and reading threads. A snapshot is not taken atomically as a whole.
+ */
+class StatisticsCounters {
+ public:
+  /**
+   * Record a write.
+   * @param written Number of written messages.
+   * @param size Number of messages to be written.
+   */
+  void recordWrite(size_t written, size_t size) {
+    if constexpr (STATISTICS_ENABLED) {
+      m_writes.fetch_add(written, std::memory_order_relaxed);
+      if (written != size) {
+        m_drops.fetch_add(size - written, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  /**
+   * Record a publish together with its time, costs a clock read.
+   * The time is recorded once per publish by the publisher and not by each subscriber.
+   * @param written Number of messages written to all subscribers.
+   * @param size Number of messages to be written.
+   */
+  void recordPublish(size_t written, size_t size) {
+    if constexpr (STATISTICS_ENABLED) {
+      recordWrite(written, size);
+      m_last_write.store(std::chrono::steady_clock::now().time_since_epoch().count(),
+                         std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Record a read, must only be called by the consumer.
+   * @param count Number of read messages.
+   */
+  void recordRead(size_t count) {
+    if constexpr (!STATISTICS_ENABLED) {
+      return;
+    }
+    m_reads.store(m_reads.load(std::memory_order_relaxed) + count, std::memory_order_relaxed);
+  }
+
+  /**
+   * Record a read from a queue, must only be called by the consumer.
+   * @param count Number of read messages.
+   * @param level Number of queued messages found by the consumer.
+   */
+  void recordRead(size_t count, size_t level) {
+    if constexpr (!STATISTICS_ENABLED) {
+      return;
+    }
+    recordRead(count);
+    if (level > m_high_water_mark.load(std::memory_order_relaxed)) {
+      m_high_water_mark.store(level, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * Take snapshot of counters.
+   * @return Current statistics.
+   */
+  Statistics getStatistics() const;
+
+ private:
+  /** Number of written messages. */
+  alignas(64) std::atomic<uint64_t> m_writes{0};
+
+  /** Number of dropped messages. */
+  std::atomic<uint64_t> m_drops{0};
+
+  /** Time of last write in ticks of steady clock. */
+  std::atomic<std::chrono::steady_clock::rep> m_last_write{0};
+
+  /** Number of read messages. */
+  alignas(64) std::atomic<uint64_t> m_reads{0};
+
+  /** Maximal number of queued messages found by the consumer. */
+  std::atomic<size_t> m_high_water_mark{0};
+};
+
+}  // namespace fdl
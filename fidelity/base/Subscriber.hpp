@@ -2,13 +2,23 @@
 
 #include <contract/contract_assert.hpp>
 
-#include <boost/lockfree/spsc_queue.hpp>
-
+#include <atomic>
+#include <chrono>
+#include <climits>
+#include <cstdint>
 #include <functional>
 #include <string>
+#include <utility>
 
+#include "Futex.hpp"
+#include "LatencyHistogram.hpp"
 #include "Loop.hpp"
-#include "PrioMutex.hpp"
+#include "MpscQueue.hpp"
+#include "OverwriteQueue.hpp"
+#include "SpscQueue.hpp"
+#include "Stamped.hpp"
+#include "StaticQueue.hpp"
+#include "Statistics.hpp"
 
 namespace fdl {
 
@@ -20,25 +30,59 @@ class ISubscriber {
   virtual const std::string& getName() const = 0;
 
   virtual bool write(const MessageT& data) = 0;
+
+  virtual size_t write(const MessageT* messages, size_t size) = 0;
+
+  /** Move message into subscriber, copies the message if not overridden. */
+  virtual bool write(MessageT&& message) {
+    return write(static_cast<const MessageT&>(message));
+  }
+
+  /** Write message waiting up to timeout for free space, writes without waiting by default. */
+  virtual bool writeFor(const MessageT& message, std::chrono::nanoseconds /*timeout*/) {
+    return write(message);
+  }
+};
+
+/**
+ * Policy when a subscriber wakes its loop on data updates.
+ * Waking a sleeping loop costs an atomic exchange and a futex wake system call, and each wake runs
+ * the loop once more, so bursts of messages are cheaper with a coalescing policy. Coalescing
+ * policies rely on the loop reading until no more messages are available in onRun().
+ */
+enum class WakePolicy {
+  ALWAYS,     ///< wake on each write
+  ON_EMPTY,   ///< wake on first write after the reader found the queue empty
+  EVERY_N,    ///< wake on every threshold-th message
+  WATERMARK,  ///< wake when threshold messages are queued after the reader found the queue empty
 };
 
 /**
  * Subscribing part of communication between running loops.
  * Subscriber receives data updates from publisher.
  * Data access is thread safe and lock free.
+ *
+ * The queue type selects the behavior on a full queue: the default SpscQueue drops the newest
+ * message and fails the write, OverwriteQueue drops the oldest message and keeps the latest
+ * capacity messages (see OverwriteSubscriber). StaticQueue stores messages inline without heap
+ * allocation (see StaticSubscriber). MpscQueue allows multiple publishers to write to the same
+ * subscriber (see MpscSubscriber). The in tree queues copy large trivially copyable messages with
+ * copy::construct(), which can bypass the cache for very large frames.
  * @tparam MessageT Type of pubsub message.
+ * @tparam QueueT Type of lock free queue.
  */
-template <typename MessageT>
+template <typename MessageT, typename QueueT = SpscQueue<MessageT>>
 class Subscriber : public ISubscriber<MessageT> {
  public:
   /**
    * Create named subscriber.
-   * If a a loop reference is passed, this loop will be woken up on each data update.
+   * If a a loop reference is passed, this loop will be woken up on data updates according to the
+   * wake policy.
    * @param name Name of subscriber.
    * @param capacity Capacity of communication connection buffer.
-   * @param loop Loop which will be woken up on each data update if wanted.
+   * @param loop Loop or WaitSet trigger which will be woken up on each data update if wanted.
    */
-  Subscriber(const std::string& name, size_t capacity, ILoop* const loop = nullptr);
+  Subscriber(const std::string& name, size_t capacity, IWakeable* const loop = nullptr);
 
   ~Subscriber() override = default;
 
@@ -58,53 +102,597 @@ class Subscriber : public ISubscriber<MessageT> {
    */
   bool write(const MessageT& message) override;
 
+  /**
+   * Move message into subscriber buffer.
+   * Queues without move support (e.g. boost::lockfree::spsc_queue as QueueT) copy the message.
+   * @param message Message data to be moved.
+   * @return true if data could be written.
+   */
+  bool write(MessageT&& message) override;
+
+  /**
+   * Construct message in place in subscriber buffer.
+   * Queues without emplace support construct a temporary message and push it.
+   * @tparam ArgsT Types of message constructor arguments.
+   * @param args Message constructor arguments.
+   * @return true if data could be written.
+   */
+  template <typename... ArgsT>
+  bool emplace(ArgsT&&... args);
+
+  /**
+   * Write data to subscriber buffer, waiting for free space if buffer is full.
+   * The writer sleeps on a futex until the reader frees space or the timeout elapsed, so it does
+   * not spin on a full buffer. Waiting needs to be enabled by setBlockingWrites(), otherwise the
+   * write doesn't wait like write(). Must not be called by realtime threads, which should use
+   * write().
+   * @param message Message data to be written.
+   * @param timeout Maximal duration to wait for free space.
+   * @return true if data could be written, false if buffer stayed full until timeout.
+   */
+  bool writeFor(const MessageT& message, std::chrono::nanoseconds timeout) override;
+
+  /**
+   * Write batch of messages to subscriber buffer.
+   * The write position is published once for the whole batch and the loop is woken up once.
+   * @param messages Messages to be written.
+   * @param size Number of messages.
+   * @return Number of written messages, less than size if buffer got full.
+   */
+  size_t write(const MessageT* messages, size_t size) override;
+
   /**
    * Read received data into an output variable.
+   * The message is moved out of the subscriber buffer.
    * Read is thread safe and lock free.
    * @param data Contains read data, if new data was received.
    * @return true if new data was successfully read, false if no data was received.
    */
   bool read(MessageT& data);
 
+  /**
+   * Read batch of received messages into an output buffer.
+   * The read position is published once for the whole batch.
+   * @param messages Output buffer for read messages.
+   * @param size Size of output buffer.
+   * @return Number of read messages.
+   */
+  size_t read(MessageT* messages, size_t size);
+
+  /**
+   * Read all received messages by calling a functor for each message.
+   * The read position is published once after all messages were handled.
+   * @tparam FunctorT Callable with signature void(const MessageT&).
+   * @param functor Functor called for each message.
+   * @return Number of read messages.
+   */
+  template <typename FunctorT>
+  size_t readAll(const FunctorT& functor);
+
+  /**
+   * Record latency between publishing and reading of Stamped messages into a histogram.
+   * Each read message costs an additional clock read. Messages with default stamp, e.g. of batches
+   * not stamped by the caller, are not recorded. Must be set before the subscriber is read.
+   * @param histogram Histogram to record latencies, nullptr disables recording.
+   */
+  void setLatencyHistogram(LatencyHistogram* histogram) {
+    static_assert(IsStamped<MessageT>::value, "Latency can only be recorded for Stamped messages.");
+    m_latency_histogram = histogram;
+  }
+
+  /**
+   * Set policy when the loop is woken up on data updates, default is WakePolicy::ALWAYS.
+   * With EVERY_N and WATERMARK messages below the threshold are only read on the next wake up,
+   * e.g. by the loop period. Must be set before the subscriber is written.
+   * @param policy Wake policy.
+   * @param threshold Number of messages for EVERY_N and WATERMARK, ignored otherwise.
+   */
+  void setWakePolicy(WakePolicy policy, size_t threshold = 1);
+
+  /**
+   * Enable writers waiting in writeFor() for free space, default is disabled.
+   * Reads of a subscriber with blocking writes enabled check for waiting writers, which costs a
+   * full memory barrier per read. Must be set before the subscriber is written or read.
+   * @param enabled true if writeFor() waits for free space.
+   */
+  void setBlockingWrites(bool enabled) {
+    m_blocking_writes = enabled;
+  }
+
+  /**
+   * Decimate written messages for slow readers of fast topics, default is no decimation.
+   * Skipped messages are neither queued nor wake the loop and count as written for the publisher.
+   * Only the interval costs a clock read per write. Must be set before the subscriber is written.
+   * @param every_nth Only every n-th written message is queued, starting with the first one.
+   * @param min_interval Minimal time between queued messages, zero disables the limit.
+   */
+  void setDecimation(size_t every_nth,
+                     std::chrono::nanoseconds min_interval = std::chrono::nanoseconds::zero());
+
+  /**
+   * Get runtime statistics: written, dropped and read messages and maximal queue fill level.
+   * Drops include messages overwritten by the queue, e.g. of an OverwriteSubscriber. The fill level
+   * is sampled by the reader, so writers don't touch the read position: SpscQueue samples it on
+   * each reload of the write position (see read_level()), other queues on each read. The time of
+   * the last write is only recorded by publishers. Can be called by any thread.
+   * @return Snapshot of statistics.
+   */
+  Statistics getStatistics() const;
+
  private:
+  /** Construct message in queue, if queue supports it. */
+  template <typename EmplaceQueueT, typename... ArgsT>
+  static auto emplaceInto(EmplaceQueueT& queue, int /*preferred*/, ArgsT&&... args)
+      -> decltype(queue.emplace(std::forward<ArgsT>(args)...)) {
+    return queue.emplace(std::forward<ArgsT>(args)...);
+  }
+
+  /** Construct temporary message and push it, fallback of emplaceInto(). */
+  template <typename... ArgsT>
+  static bool emplaceInto(QueueT& queue, long /*fallback*/, ArgsT&&... args) {
+    return queue.push(MessageT(std::forward<ArgsT>(args)...));
+  }
+
+  /** Get number of messages dropped by the queue, if queue supports it. */
+  template <typename DropQueueT>
+  static auto droppedBy(const DropQueueT& queue, int /*preferred*/) -> decltype(queue.dropped()) {
+    return queue.dropped();
+  }
+
+  /** Get queue fill level found by the consumer, if queue supports it. */
+  template <typename LevelQueueT>
+  static auto readLevel(const LevelQueueT& queue, size_t /*count*/, int /*preferred*/)
+      -> decltype(queue.read_level()) {
+    return queue.read_level();
+  }
+
+  /** Get queue fill level from read and remaining messages, fallback of readLevel(). */
+  static size_t readLevel(const QueueT& queue, size_t count, long /*fallback*/) {
+    return count + queue.read_available();
+  }
+
+  /** Queue drops no messages itself, fallback of droppedBy(). */
+  static uint64_t droppedBy(const QueueT& /*queue*/, long /*fallback*/) {
+    return 0;
+  }
+
+  /** Read all messages by calling functor, see readAll(). */
+  template <typename FunctorT>
+  size_t consumeAll(const FunctorT& functor);
+
+  /** Record statistics of count read messages together with the queue fill level. */
+  void recordRead(size_t count) {
+    if constexpr (STATISTICS_ENABLED) {
+      m_statistics.recordRead(count, readLevel(m_queue, count, 0));
+    }
+  }
+
+  /** Record latency of read messages, if recording is enabled. */
+  void recordLatency(const MessageT* messages, size_t size);
+
+  /** Record statistics and wake loop after pushing size messages, of which written succeeded. */
+  void notify(size_t written, size_t size);
+
+  /**
+   * Arm wake up after the reader found the queue empty.
+   * @return true if the reader needs to read once more, to catch messages written concurrently.
+   */
+  bool arm();
+
+  /** Wake writers waiting for free space in writeFor() after the reader freed space. */
+  void release();
+
+  /** Minimal interval claimed by a queued message, see skip(). */
+  struct Interval {
+    /** Earliest time of the next queued message before the claim. */
+    int64_t previous{0};
+
+    /** Earliest time of the next queued message after the claim, 0 if nothing was claimed. */
+    int64_t next{0};
+  };
+
+  /**
+   * Apply decimation to a written message.
+   * @param interval Minimal interval claimed by the message, if it isn't skipped.
+   * @return true if the message is skipped.
+   */
+  bool skip(Interval& interval);
+
+  /** Give back interval claimed by a message, which couldn't be queued. */
+  void unclaim(const Interval& interval);
+
+  /** Write batch message by message if decimation is set, see write(). */
+  size_t writeDecimated(const MessageT* messages, size_t size);
+
   /** Name of subscriber. */
   const std::string m_name{};
 
   /**
-   * Single producer single consumer queue of boost is sufficient for publisher subscriber setup.
-   * MessageT does not be trivial constructable or destructable which is an advantage to other boost
-   * lock free queues. Queue configured with fixed size to avoid dynamic memory allocation during
-   * writes.
+   * Lock free queue between publisher and reader, by default the single producer single consumer
+   * SpscQueue. MessageT does not need to be trivially constructible or destructible. Queue is
+   * configured with fixed size to avoid dynamic memory allocation during writes.
    */
-  boost::lockfree::spsc_queue<MessageT> m_queue{};
+  QueueT m_queue;
 
   /**
    * Loop to be woken up on each data write.
    * No shared ptr so far, cause then we would need to enable feature: enable_shared_from_this for
    * loops.
    */
-  ILoop* const m_loop{};
+  IWakeable* const m_loop{};
+
+  /** Policy when loop is woken up. */
+  WakePolicy m_wake_policy{WakePolicy::ALWAYS};
+
+  /** Message threshold of wake policy. */
+  size_t m_wake_threshold{1};
+
+  /** Only every n-th written message is queued. */
+  size_t m_decimation{1};
+
+  /** Minimal time between queued messages. */
+  std::chrono::nanoseconds m_min_interval{0};
+
+  /** Number of written messages for decimation. */
+  std::atomic<size_t> m_decimation_count{0};
+
+  /** Earliest time in ns of steady clock, when the next message is queued. */
+  std::atomic<int64_t> m_next_write{0};
+
+  /** Set by reader on empty queue, cleared by the writer which wakes the loop. */
+  alignas(64) std::atomic<bool> m_wake_armed{true};
+
+  /** Number of written messages for WakePolicy::EVERY_N. */
+  std::atomic<size_t> m_write_count{0};
+
+  /** Writers may wait for free space in writeFor(), see setBlockingWrites(). */
+  bool m_blocking_writes{false};
+
+  /** Futex word, incremented by the reader when it freed space for waiting writers. */
+  alignas(64) std::atomic<uint32_t> m_space{0};
+
+  /** Number of writers waiting for free space. */
+  std::atomic<uint32_t> m_space_waiters{0};
+
+  /** Runtime statistics. */
+  StatisticsCounters m_statistics{};
+
+  /** Histogram to record latency of Stamped messages. */
+  LatencyHistogram* m_latency_histogram{nullptr};
 };
 
-template <typename MessageT>
-Subscriber<MessageT>::Subscriber(const std::string& name, size_t capacity, ILoop* const loop)
+template <typename MessageT, typename QueueT>
+Subscriber<MessageT, QueueT>::Subscriber(const std::string& name, size_t capacity,
+                                         IWakeable* const loop)
     : m_name(name), m_queue(capacity), m_loop(loop) {
   EXPECT(!name.empty(), "Name must be empty.");
   EXPECT(capacity > 0, "Capacity must be greater 0.");
 }
 
-template <typename MessageT>
-bool Subscriber<MessageT>::read(MessageT& message) {
-  return m_queue.pop(message);
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::setWakePolicy(WakePolicy policy, size_t threshold) {
+  EXPECT(threshold > 0, "Threshold must be greater 0.");
+  m_wake_policy = policy;
+  m_wake_threshold = threshold;
 }
 
-template <typename MessageT>
-bool Subscriber<MessageT>::write(const MessageT& message) {
-  bool written = m_queue.push(message);
-  if (m_loop != nullptr) {
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::setDecimation(size_t every_nth,
+                                                 std::chrono::nanoseconds min_interval) {
+  EXPECT(every_nth > 0, "Decimation must be greater 0.");
+  EXPECT(min_interval >= std::chrono::nanoseconds::zero(), "Interval must not be negative.");
+  m_decimation = every_nth;
+  m_min_interval = min_interval;
+}
+
+template <typename MessageT, typename QueueT>
+Statistics Subscriber<MessageT, QueueT>::getStatistics() const {
+  Statistics statistics = m_statistics.getStatistics();
+  if constexpr (STATISTICS_ENABLED) {
+    statistics.drops += droppedBy(m_queue, 0);
+  }
+  return statistics;
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::skip(Interval& interval) {
+  if (m_decimation > 1 &&
+      m_decimation_count.fetch_add(1, std::memory_order_relaxed) % m_decimation != 0) {
+    return true;
+  }
+  if (m_min_interval > std::chrono::nanoseconds::zero()) {
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now().time_since_epoch())
+                            .count();
+    int64_t next_write = m_next_write.load(std::memory_order_relaxed);
+    do {
+      if (now < next_write) {
+        return true;
+      }
+    } while (!m_next_write.compare_exchange_weak(next_write, now + m_min_interval.count(),
+                                                 std::memory_order_relaxed));
+    interval.previous = next_write;
+    interval.next = now + m_min_interval.count();
+  }
+  return false;
+}
+
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::unclaim(const Interval& interval) {
+  // only roll back if no other writer claimed a later interval in the meantime
+  int64_t next_write = interval.next;
+  if (next_write != 0) {
+    m_next_write.compare_exchange_strong(next_write, interval.previous, std::memory_order_relaxed);
+  }
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::read(MessageT& message) {
+  auto move_out = [&message](MessageT& queued_message) { message = std::move(queued_message); };
+  if (m_queue.consume_one(move_out) || (arm() && m_queue.consume_one(move_out))) {
+    release();
+    recordRead(1);
+    recordLatency(&message, 1);
+    return true;
+  }
+  return false;
+}
+
+template <typename MessageT, typename QueueT>
+size_t Subscriber<MessageT, QueueT>::read(MessageT* messages, size_t size) {
+  size_t count = m_queue.pop(messages, size);
+  if (count < size && arm()) {
+    count += m_queue.pop(messages + count, size - count);  // NOLINT
+  }
+  if (count > 0) {
+    release();
+  }
+  recordRead(count);
+  recordLatency(messages, count);
+  return count;
+}
+
+template <typename MessageT, typename QueueT>
+template <typename FunctorT>
+size_t Subscriber<MessageT, QueueT>::readAll(const FunctorT& functor) {
+  if constexpr (IsStamped<MessageT>::value) {
+    if (m_latency_histogram != nullptr) {
+      return consumeAll([this, &functor](MessageT& message) {
+        if (message.stamp != std::chrono::steady_clock::time_point{}) {
+          m_latency_histogram->record(std::chrono::steady_clock::now() - message.stamp);
+        }
+        functor(message);
+      });
+    }
+  }
+  return consumeAll(functor);
+}
+
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::recordLatency(const MessageT* messages, size_t size) {
+  if constexpr (IsStamped<MessageT>::value) {
+    if (m_latency_histogram != nullptr && size > 0) {
+      const auto now = std::chrono::steady_clock::now();
+      for (size_t index = 0; index < size; ++index) {
+        // batches may contain messages without stamp, which have no latency
+        if (messages[index].stamp != std::chrono::steady_clock::time_point{}) {  // NOLINT
+          m_latency_histogram->record(now - messages[index].stamp);               // NOLINT
+        }
+      }
+    }
+  }
+}
+
+template <typename MessageT, typename QueueT>
+template <typename FunctorT>
+size_t Subscriber<MessageT, QueueT>::consumeAll(const FunctorT& functor) {
+  size_t count = m_queue.consume_all(functor);
+  if (arm()) {
+    count += m_queue.consume_all(functor);
+  }
+  if (count > 0) {
+    release();
+  }
+  recordRead(count);
+  return count;
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::arm() {
+  if (m_wake_policy != WakePolicy::ON_EMPTY && m_wake_policy != WakePolicy::WATERMARK) {
+    return false;
+  }
+  // pairs with fence in notify(): either the writer sees the armed flag or the reader sees the
+  // message, so no wake up is lost
+  m_wake_armed.store(true, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  return true;
+}
+
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::release() {
+  if (!m_blocking_writes) {
+    return;
+  }
+  // pairs with fence in writeFor(): either the writer sees the free space or the reader sees the
+  // waiting writer
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (m_space_waiters.load(std::memory_order_relaxed) != 0) {
+    m_space.fetch_add(1, std::memory_order_release);
+    futex::wake(m_space, INT_MAX);
+  }
+}
+
+template <typename MessageT, typename QueueT>
+void Subscriber<MessageT, QueueT>::notify(size_t written, size_t size) {
+  m_statistics.recordWrite(written, size);
+  if (m_loop == nullptr || size == 0) {
+    return;
+  }
+  bool wake = false;
+  switch (m_wake_policy) {
+    case WakePolicy::ALWAYS:
+      wake = true;
+      break;
+    case WakePolicy::EVERY_N: {
+      const size_t count = m_write_count.fetch_add(written, std::memory_order_relaxed);
+      wake = count / m_wake_threshold != (count + written) / m_wake_threshold;
+      break;
+    }
+    case WakePolicy::ON_EMPTY:
+    case WakePolicy::WATERMARK:
+      if (written == 0) {
+        break;
+      }
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      wake = m_wake_armed.load(std::memory_order_relaxed) &&
+             (m_wake_policy == WakePolicy::ON_EMPTY ||
+              m_queue.read_available() >= m_wake_threshold) &&
+             m_wake_armed.exchange(false, std::memory_order_relaxed);
+      break;
+  }
+  if (wake) {
     m_loop->wake();
   }
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::write(const MessageT& message) {
+  Interval interval;
+  if (skip(interval)) {
+    return true;
+  }
+  bool written = m_queue.push(message);
+  if (!written) {
+    unclaim(interval);
+  }
+  notify(written ? 1 : 0, 1);
+  return written;
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::write(MessageT&& message) {
+  Interval interval;
+  if (skip(interval)) {
+    return true;
+  }
+  bool written = m_queue.push(std::move(message));
+  if (!written) {
+    unclaim(interval);
+  }
+  notify(written ? 1 : 0, 1);
   return written;
 }
 
+template <typename MessageT, typename QueueT>
+template <typename... ArgsT>
+bool Subscriber<MessageT, QueueT>::emplace(ArgsT&&... args) {
+  Interval interval;
+  if (skip(interval)) {
+    return true;
+  }
+  bool written = emplaceInto(m_queue, 0, std::forward<ArgsT>(args)...);
+  if (!written) {
+    unclaim(interval);
+  }
+  notify(written ? 1 : 0, 1);
+  return written;
+}
+
+template <typename MessageT, typename QueueT>
+bool Subscriber<MessageT, QueueT>::writeFor(const MessageT& message,
+                                            std::chrono::nanoseconds timeout) {
+  Interval interval;
+  if (skip(interval)) {
+    return true;
+  }
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  bool written = m_queue.push(message);
+  while (!written && m_blocking_writes) {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::nanoseconds::zero()) {
+      break;
+    }
+    // space is read before the retry, so space freed after the retry lets the futex wait fail
+    const uint32_t space = m_space.load(std::memory_order_acquire);
+    m_space_waiters.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    written = m_queue.push(message);
+    if (!written) {
+      futex::waitFor(m_space, space, remaining);
+    }
+    m_space_waiters.fetch_sub(1, std::memory_order_relaxed);
+  }
+  if (!written) {
+    unclaim(interval);
+  }
+  notify(written ? 1 : 0, 1);
+  return written;
+}
+
+template <typename MessageT, typename QueueT>
+size_t Subscriber<MessageT, QueueT>::write(const MessageT* messages, size_t size) {
+  if (m_decimation > 1 || m_min_interval > std::chrono::nanoseconds::zero()) {
+    return writeDecimated(messages, size);
+  }
+  size_t written = m_queue.push(messages, size);
+  notify(written, size);
+  return written;
+}
+
+template <typename MessageT, typename QueueT>
+size_t Subscriber<MessageT, QueueT>::writeDecimated(const MessageT* messages, size_t size) {
+  size_t queued = 0;
+  size_t index = 0;
+  for (; index < size; ++index) {
+    Interval interval;
+    if (skip(interval)) {
+      continue;
+    }
+    if (!m_queue.push(messages[index])) {  // NOLINT
+      unclaim(interval);
+      break;
+    }
+    ++queued;
+  }
+  // skipped messages count as written, the first message which didn't fit ends the batch
+  notify(queued, queued + (index < size ? 1 : 0));
+  return index;
+}
+
+/**
+ * Subscriber, which overwrites the oldest message if its queue is full.
+ * Writes never fail and a slow reader always sees the latest capacity messages.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+using OverwriteSubscriber = Subscriber<MessageT, OverwriteQueue<MessageT>>;
+
+/**
+ * Subscriber, which can be written by multiple publishers concurrently.
+ * Messages of each publisher are received in the order they were written.
+ * @tparam MessageT Type of pubsub message.
+ */
+template <typename MessageT>
+using MpscSubscriber = Subscriber<MessageT, MpscQueue<MessageT>>;
+
+/**
+ * Subscriber with compile time capacity.
+ * The queue is stored inline, so the subscriber does not allocate memory and can be placed in
+ * static or locked memory.
+ * @tparam MessageT Type of pubsub message.
+ * @tparam Capacity Capacity of queue, needs to be a power of two.
+ */
+template <typename MessageT, size_t Capacity>
+class StaticSubscriber : public Subscriber<MessageT, StaticQueue<MessageT, Capacity>> {
+ public:
+  /**
+   * Create named subscriber.
+   * @param name Name of subscriber.
+   * @param loop Loop or WaitSet trigger which will be woken up on each data update if wanted.
+   */
+  explicit StaticSubscriber(const std::string& name, IWakeable* const loop = nullptr)
+      : Subscriber<MessageT, StaticQueue<MessageT, Capacity>>(name, Capacity, loop) {}
+};
+
 }  // namespace fdl
@@ -10,10 +10,9 @@
 #include <climits>
 #include <cstdlib>
 #include <memory>
-#include <mutex>
 #include <thread>
 
-#include "PrioMutex.hpp"
+#include "Futex.hpp"
 #include "SystemAdapter.hpp"
 
 using namespace std::chrono_literals;
@@ -79,6 +78,13 @@ void Thread::setPeriod(std::chrono::microseconds period) {
   }
 }
 
+void Thread::setEventTriggered(bool is_event_triggered) {
+  // only set if thread is not created
+  if (!m_created) {
+    m_is_event_triggered = is_event_triggered;
+  }
+}
+
 void Thread::setStackSize(size_t size) {
   // only set if thread is not created
   if (!m_created) {
@@ -167,12 +173,21 @@ void Thread::cancel() {
 }
 
 void Thread::wake() {
-  std::unique_lock<std::mutex> lock(m_prio_mutex);
-  if (!m_got_wake_up) {
-    m_got_wake_up = true;
-    lock.unlock();
-    m_wake_up_cond_var.notify_one();
-    // TODO(sk) wake up sleeping non rt thread too
+  // purely periodic threads only run on their period
+  if (m_period > 0us && !m_is_event_triggered) {
+    return;
+  }
+  signal();
+}
+
+void Thread::signal() {
+  // already signaled threads run again anyway, the signal is consumed by the thread
+  if (m_wake_state.load(std::memory_order_acquire) == WAKE_SIGNALED) {
+    return;
+  }
+  // only enter the kernel if the thread actually sleeps
+  if (m_wake_state.exchange(WAKE_SIGNALED, std::memory_order_acq_rel) == WAKE_WAITING) {
+    futex::wake(m_wake_state, 1);
   }
 }
 
@@ -183,30 +198,33 @@ void* Thread::threadRun(void* thread) {
 
 void Thread::run() {
   auto tick = std::chrono::steady_clock::now();
-  auto next_tick = tick;
   while (m_is_running) {
     m_update();
-    std::unique_lock<std::mutex> lock(m_prio_mutex);
-    if (m_is_running && !m_got_wake_up) {
+    uint32_t state = WAKE_IDLE;
+    // announce sleeping, fails if thread was woken during update
+    if (m_wake_state.compare_exchange_strong(state, WAKE_WAITING, std::memory_order_acq_rel)) {
       if (m_period > 0us) {
-        next_tick = tick + m_period;  // get relative sleep time
-        while (!m_got_wake_up) {
-          if (m_wake_up_cond_var.wait_until(lock, next_tick) == std::cv_status::timeout) {
-            m_got_wake_up = true;
+        // absolute deadline on CLOCK_MONOTONIC, so interrupted waits don't drift
+        tick += m_period;
+        while (m_wake_state.load(std::memory_order_acquire) == WAKE_WAITING) {
+          if (!futex::waitUntil(m_wake_state, WAKE_WAITING, tick)) {
+            break;
           }
         }
-        tick = next_tick;
       } else {
-        m_wake_up_cond_var.wait(lock, [&] { return m_got_wake_up.load(); });
+        while (m_wake_state.load(std::memory_order_acquire) == WAKE_WAITING) {
+          futex::wait(m_wake_state, WAKE_WAITING);
+        }
       }
-      m_got_wake_up = false;  // clear for next wait
     }
+    // consume wake up, a wake up racing with the end of the period is handled by this run
+    m_wake_state.exchange(WAKE_IDLE, std::memory_order_acq_rel);
   }
 }
 
 void Thread::stop() {
   m_is_running = false;
-  wake();
+  signal();
 }
 
 void Thread::join() {
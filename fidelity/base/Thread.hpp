@@ -4,14 +4,12 @@
 
 #include <atomic>
 #include <chrono>
-#include <condition_variable>
 #include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 
-#include "PrioMutex.hpp"
-
 namespace fdl {
 
 struct SystemAdapter;
@@ -32,6 +30,9 @@ class IThread {
   /** @copydoc Thread::setPeriod */
   virtual void setPeriod(std::chrono::microseconds period) = 0;
 
+  /** @copydoc Thread::setEventTriggered */
+  virtual void setEventTriggered(bool is_event_triggered) = 0;
+
   /** @copydoc Thread::setStackSize */
   virtual void setStackSize(size_t size) = 0;
 
@@ -57,7 +58,10 @@ class IThread {
  * affinity can be set of each thread. On Thread::run() the given update() function is called.
  *
  * Threads have to be configured either as event triggered or periodic threads. Event triggered
- * threads will be woken up by calling wake(). Periodic threads always sleep a configured duration.
+ * threads will be woken up by calling wake(). Periodic threads sleep on a futex until the absolute
+ * time of the next period on CLOCK_MONOTONIC, so the period doesn't drift. Periodic threads, which
+ * are not event triggered, only differ in ignoring wake(), stop() still ends their sleep. wake()
+ * needs no lock and no system call, unless the thread actually sleeps.
  *
  * @note Can't use c++11 std::threads because of missing interfaces to set stack size, scheduler,
  * priority, stack size and affinity.
@@ -89,6 +93,14 @@ class Thread : public IThread {
    */
   void setPeriod(std::chrono::microseconds period) override;
 
+  /**
+   * Set event triggering of periodic thread (default true).
+   * A periodic thread, which is not event triggered, ignores wake() and only runs on its period,
+   * stop() still ends its sleep. Has no effect on threads without period.
+   * @param is_event_triggered false if thread is only triggered by its period.
+   */
+  void setEventTriggered(bool is_event_triggered) override;
+
   /**
    * Set stack size of thread.
    * Wanted stack size on top of PTHREAD_STACK_MIN. The actual stack size may be greater than the
@@ -111,7 +123,10 @@ class Thread : public IThread {
   /** Cancel thread. */
   void cancel() override;
 
-  /** Wake thread, which will end in calling run(). */
+  /**
+   * Wake thread, which will end in calling run().
+   * Only enters the kernel if the thread sleeps, waking a running thread just sets a flag.
+   */
   void wake() override;
 
   /**
@@ -143,6 +158,9 @@ class Thread : public IThread {
 
   void run();
 
+  /** Wake thread regardless of its triggering, e.g. to stop it. */
+  void signal();
+
  private:
   /** System adapter class dependency injection for tests. */
   static std::shared_ptr<SystemAdapter> m_system_di;
@@ -183,17 +201,20 @@ class Thread : public IThread {
   /** Update functor to be called from thread. */
   std::function<void()> m_update;
 
-  /**
-   * Mutex for synchronizing thread wake up.
-   * @see http://en.cppreference.com/w/cpp/thread/condition_variable
-   */
-  PrioMutex m_prio_mutex{};
+  /** Thread runs update(), nobody woke it. */
+  static constexpr uint32_t WAKE_IDLE = 0;
 
-  /** Condition variable for waiting for wake up. */
-  std::condition_variable m_wake_up_cond_var{};
+  /** Thread was woken and runs update() again. */
+  static constexpr uint32_t WAKE_SIGNALED = 1;
 
-  /** Wake up state of the tread, to be checked before wait. */
-  std::atomic<bool> m_got_wake_up{false};
+  /** Thread sleeps on futex and needs a futex wake up. */
+  static constexpr uint32_t WAKE_WAITING = 2;
+
+  /**
+   * Wake up state of thread, also used as futex word to sleep on.
+   * Waking an already woken or running thread is a single atomic operation without system call.
+   */
+  alignas(64) std::atomic<uint32_t> m_wake_state{WAKE_IDLE};
 
   /** Running state of thread. */
   std::atomic<bool> m_is_running{false};
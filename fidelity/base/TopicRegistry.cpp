@@ -0,0 +1,47 @@
+#include "TopicRegistry.hpp"
+
+#include <contract/contract_assert.hpp>
+
+namespace fdl {
+
+TopicRegistry& TopicRegistry::instance() {
+  static TopicRegistry registry;
+  return registry;
+}
+
+bool TopicRegistry::contains(const std::string& topic) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_topics.find(topic) != m_topics.end();
+}
+
+void TopicRegistry::clear() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_topics.clear();
+}
+
+bool TopicRegistry::isPublishedBy(const std::string& topic, const ILoop* loop) const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto found_topic = m_topics.find(topic);
+  return loop != nullptr && found_topic != m_topics.end() && found_topic->second.owner == loop;
+}
+
+std::shared_ptr<void> TopicRegistry::find(const std::string& topic, std::type_index type,
+                                          const std::function<std::shared_ptr<void>()>& create,
+                                          const ILoop* owner) {
+  EXPECT(!topic.empty(), "Topic needs to be named.");
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto found_topic = m_topics.find(topic);
+  if (found_topic == m_topics.end()) {
+    found_topic = m_topics.emplace(topic, Topic{type, create(), nullptr}).first;
+  }
+  EXPECT(found_topic->second.type == type, "Message type does not match type of topic.");
+  if (owner != nullptr) {
+    EXPECT(found_topic->second.owner == nullptr || found_topic->second.owner == owner,
+           "Topic is already published by another loop.");
+    found_topic->second.owner = owner;
+  }
+  return found_topic->second.publisher;
+}
+
+}  // namespace fdl
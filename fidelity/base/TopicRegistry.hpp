@@ -0,0 +1,165 @@
+#pragma once
+
+#include <contract/contract_assert.hpp>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <utility>
+
+#include "DirectSubscriber.hpp"
+#include "Loop.hpp"
+#include "Publisher.hpp"
+#include "Subscriber.hpp"
+
+namespace fdl {
+
+/**
+ * Process wide registry of topics for wiring publishers and subscribers by name.
+ * Each topic is served by one Publisher, which is created on first use, so loops can declare
+ * their publishers and subscribers in onConfigure() in any order. Lookups are done once on
+ * configuration and return direct pointers, nothing is looked up while messages are written.
+ * The registry allocates memory, so it must not be used by realtime threads.
+ *
+ * A publisher can be declared with its owning loop. Readers in the same loop can then be
+ * connected by a DirectSubscriber, which is called directly by the publisher instead of passing
+ * messages through a queue and waking the loop.
+ */
+class TopicRegistry {
+ public:
+  TopicRegistry() = default;
+
+  TopicRegistry(const TopicRegistry&) = delete;
+  TopicRegistry(TopicRegistry&&) = delete;
+  TopicRegistry& operator=(TopicRegistry&&) = delete;
+  TopicRegistry& operator=(const TopicRegistry&) = delete;
+
+  ~TopicRegistry() = default;
+
+  /**
+   * Get process wide registry.
+   * @return Registry instance.
+   */
+  static TopicRegistry& instance();
+
+  /**
+   * Get publisher of topic, the publisher is created if the topic is unknown.
+   * The message type needs to match for all users of a topic.
+   * @tparam MessageT Type of pubsub message.
+   * @param topic Name of topic.
+   * @param owner Loop writing the publisher, needs to match for all users declaring an owner.
+   * @return Publisher of topic.
+   */
+  template <typename MessageT>
+  std::shared_ptr<Publisher<MessageT>> publisher(const std::string& topic,
+                                                 const ILoop* owner = nullptr);
+
+  /**
+   * Create subscriber and subscribe it to the publisher of topic.
+   * @tparam MessageT Type of pubsub message.
+   * @tparam SubscriberT Type of subscriber, Subscriber<MessageT> by default.
+   * @tparam ArgsT Types of subscriber constructor arguments.
+   * @param topic Name of topic.
+   * @param args Subscriber constructor arguments, starting with its name.
+   * @return Subscribed subscriber, nullptr if a subscriber of the same name already exists.
+   */
+  template <typename MessageT, typename SubscriberT = Subscriber<MessageT>, typename... ArgsT>
+  std::shared_ptr<SubscriberT> subscriber(const std::string& topic, ArgsT&&... args);
+
+  /**
+   * Create direct subscriber and subscribe it to the publisher of topic, if the publisher is owned
+   * by loop. Messages are passed to callback by the publishing thread without queue or wake up.
+   * The publisher needs to be declared with its owner before.
+   * @tparam MessageT Type of pubsub message.
+   * @param topic Name of topic.
+   * @param name Name of subscriber.
+   * @param loop Loop of the reader.
+   * @param callback Callback called for each message.
+   * @return Subscribed subscriber, nullptr if the topic is not published by loop or a subscriber of
+   *         the same name already exists. Use a queued subscriber in that case.
+   */
+  template <typename MessageT>
+  std::shared_ptr<DirectSubscriber<MessageT>> directSubscriber(
+      const std::string& topic, const std::string& name, const ILoop* loop,
+      typename DirectSubscriber<MessageT>::Callback callback);
+
+  /**
+   * Check if a topic is published by loop.
+   * @param topic Name of topic.
+   * @param loop Loop to check.
+   * @return true if the publisher of topic was declared with loop as owner.
+   */
+  bool isPublishedBy(const std::string& topic, const ILoop* loop) const;
+
+  /**
+   * Check if a topic is registered.
+   * @param topic Name of topic.
+   * @return true if topic is registered.
+   */
+  bool contains(const std::string& topic) const;
+
+  /**
+   * Remove all topics. Publishers and subscribers stay alive as long as they are referenced.
+   */
+  void clear();
+
+ private:
+  /** Registered topic. */
+  struct Topic {
+    /** Message type of topic. */
+    std::type_index type;
+    /** Publisher<MessageT> of topic. */
+    std::shared_ptr<void> publisher;
+    /** Loop writing the publisher, if declared. */
+    const ILoop* owner;
+  };
+
+  /** Get publisher of topic or create it, if topic is unknown. Records owner if not null. */
+  std::shared_ptr<void> find(const std::string& topic, std::type_index type,
+                             const std::function<std::shared_ptr<void>()>& create,
+                             const ILoop* owner);
+
+  /** Guards topics. */
+  mutable std::mutex m_mutex{};
+
+  /** Registered topics by name. */
+  std::unordered_map<std::string, Topic> m_topics{};
+};
+
+template <typename MessageT>
+std::shared_ptr<Publisher<MessageT>> TopicRegistry::publisher(const std::string& topic,
+                                                              const ILoop* owner) {
+  auto create = [&topic] { return std::make_shared<Publisher<MessageT>>(topic); };
+  return std::static_pointer_cast<Publisher<MessageT>>(
+      find(topic, typeid(MessageT), create, owner));
+}
+
+template <typename MessageT, typename SubscriberT, typename... ArgsT>
+std::shared_ptr<SubscriberT> TopicRegistry::subscriber(const std::string& topic, ArgsT&&... args) {
+  auto subscriber = std::make_shared<SubscriberT>(std::forward<ArgsT>(args)...);
+  if (!publisher<MessageT>(topic)->subscribe(subscriber)) {
+    return nullptr;
+  }
+  return subscriber;
+}
+
+template <typename MessageT>
+std::shared_ptr<DirectSubscriber<MessageT>> TopicRegistry::directSubscriber(
+    const std::string& topic, const std::string& name, const ILoop* loop,
+    typename DirectSubscriber<MessageT>::Callback callback) {
+  EXPECT(loop != nullptr, "Loop needs to be set.");
+  auto publisher = this->publisher<MessageT>(topic);
+  if (!isPublishedBy(topic, loop)) {
+    return nullptr;
+  }
+  auto subscriber = std::make_shared<DirectSubscriber<MessageT>>(name, std::move(callback));
+  if (!publisher->subscribe(subscriber)) {
+    return nullptr;
+  }
+  return subscriber;
+}
+
+}  // namespace fdl
@@ -0,0 +1,27 @@
+#include "WaitSet.hpp"
+
+#include <contract/contract_assert.hpp>
+
+namespace fdl {
+
+WaitSet::WaitSet(IWakeable* loop) : m_loop(loop) {
+  EXPECT(loop != nullptr, "Loop must not be nullptr.");
+  for (size_t index = 0; index < CAPACITY; ++index) {
+    m_triggers[index].m_wait_set = this;
+    m_triggers[index].m_mask = uint64_t{1} << index;
+  }
+}
+
+IWakeable* WaitSet::trigger(size_t index) {
+  EXPECT(index < CAPACITY, "Index exceeds capacity of wait set.");
+  return &m_triggers[index];
+}
+
+void WaitSet::Trigger::wake() {
+  // loop is already woken up, if other inputs are pending
+  if (m_wait_set->m_ready.fetch_or(m_mask, std::memory_order_acq_rel) == 0) {
+    m_wait_set->m_loop->wake();
+  }
+}
+
+}  // namespace fdl
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+#include "Loop.hpp"
+
+namespace fdl {
+
+/**
+ * Readiness tracking for a loop reading many subscribers.
+ * Each subscriber gets its own trigger instead of the loop as wakeable. A trigger marks its bit
+ * in an atomic ready mask and wakes the loop only if no other input was pending, so onRun() can
+ * handle just the inputs, which received data since the last run:
+ *
+ *   m_wait_set.forEachReady([this](size_t index) { drain(index); });
+ *
+ * Inputs need to be read until empty, otherwise remaining messages are handled after the next
+ * wake up of the same input. Up to 64 inputs are supported.
+ */
+class WaitSet {
+ public:
+  /** Maximal number of inputs. */
+  static constexpr size_t CAPACITY = 64;
+
+  /**
+   * Create wait set.
+   * @param loop Loop which will be woken up, if an input becomes ready.
+   */
+  explicit WaitSet(IWakeable* loop);
+
+  WaitSet(const WaitSet&) = delete;
+  WaitSet(WaitSet&&) = delete;
+  WaitSet& operator=(WaitSet&&) = delete;
+  WaitSet& operator=(const WaitSet&) = delete;
+
+  ~WaitSet() = default;
+
+  /**
+   * Get trigger of an input, which is passed as wakeable to its subscriber.
+   * @param index Index of input, less than CAPACITY.
+   * @return Trigger marking the input as ready.
+   */
+  IWakeable* trigger(size_t index);
+
+  /**
+   * Take ready inputs and reset them.
+   * @return Mask of ready inputs, bit n is set if input n is ready.
+   */
+  uint64_t takeReady() {
+    return m_ready.exchange(0, std::memory_order_acq_rel);
+  }
+
+  /**
+   * Take ready inputs and call functor for each of them in order of their index.
+   * @tparam FunctorT Callable with signature void(size_t index).
+   * @param functor Functor called for each ready input.
+   * @return Number of ready inputs.
+   */
+  template <typename FunctorT>
+  size_t forEachReady(const FunctorT& functor);
+
+ private:
+  /** Marks an input ready and wakes the loop. */
+  class Trigger : public IWakeable {
+   public:
+    Trigger() = default;
+
+    Trigger(const Trigger&) = delete;
+    Trigger(Trigger&&) = delete;
+    Trigger& operator=(Trigger&&) = delete;
+    Trigger& operator=(const Trigger&) = delete;
+
+    ~Trigger() override = default;
+
+    void wake() override;
+
+    /** Wait set of input. */
+    WaitSet* m_wait_set{nullptr};
+
+    /** Bit of input in ready mask. */
+    uint64_t m_mask{0};
+  };
+
+  /** Loop to be woken up. */
+  IWakeable* const m_loop{};
+
+  /** Triggers of inputs. */
+  std::array<Trigger, CAPACITY> m_triggers{};
+
+  /** Mask of ready inputs. */
+  alignas(64) std::atomic<uint64_t> m_ready{0};
+};
+
+template <typename FunctorT>
+size_t WaitSet::forEachReady(const FunctorT& functor) {
+  size_t count = 0;
+  for (uint64_t ready = takeReady(); ready != 0; ready &= ready - 1) {
+    functor(static_cast<size_t>(__builtin_ctzll(ready)));
+    ++count;
+  }
+  return count;
+}
+
+}  // namespace fdl
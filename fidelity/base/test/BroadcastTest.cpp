@@ -0,0 +1,138 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+
+#include "Definitions.hpp"
+#include "LoopMock.hpp"
+
+#include "../Broadcast.hpp"
+#include "../Publisher.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::broadcast {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+using Topic = BroadcastTopic<Message>;
+
+class BASE_BroadcastTest : public t::Test {};
+
+DESCRIBE_F(BASE_BroadcastTest, constructor, should_check_precondidtions) {
+  // expect non empty name
+  EXPECT_THROW(Topic("", 1), std::experimental::contract_violation_error);
+  // expect capacity greater than 0
+  EXPECT_THROW(Topic("topic", 0), std::experimental::contract_violation_error);
+  // expect non empty subscriber name
+  EXPECT_THROW(BroadcastSubscriber<Message>(""), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_BroadcastTest, subscribe, should_return_false, if_subscriber_is_invalid) {
+  Topic topic("topic", 1);
+  Topic other_topic("other_topic", 1);
+  auto subscriber = std::make_shared<BroadcastSubscriber<Message>>("subscriber");
+  auto same_name = std::make_shared<BroadcastSubscriber<Message>>("subscriber");
+
+  EXPECT_FALSE(topic.subscribe(nullptr));
+  EXPECT_TRUE(topic.subscribe(subscriber));
+  EXPECT_FALSE(topic.subscribe(same_name));
+  // already subscribed to other topic
+  EXPECT_FALSE(other_topic.subscribe(subscriber));
+}
+
+DESCRIBE_F(BASE_BroadcastTest, write, should_be_read_by_all_subscribers) {
+  LoopMock mock_1;
+  LoopMock mock_2;
+  Publisher<Message> publisher("publisher");
+  auto topic = std::make_shared<Topic>("topic", 4);
+  auto subscriber_1 = std::make_shared<BroadcastSubscriber<Message>>("subscriber_1", &mock_1);
+  auto subscriber_2 = std::make_shared<BroadcastSubscriber<Message>>("subscriber_2", &mock_2);
+  EXPECT_TRUE(publisher.subscribe(topic));
+  EXPECT_TRUE(topic->subscribe(subscriber_1));
+  EXPECT_TRUE(topic->subscribe(subscriber_2));
+
+  EXPECT_CALL(mock_1, wake()).Times(2);
+  EXPECT_CALL(mock_2, wake()).Times(2);
+  EXPECT_TRUE(publisher.write({1, 0.5}));
+  EXPECT_TRUE(publisher.write({2, 1.5}));
+
+  Message message;
+  EXPECT_TRUE(subscriber_1->read(message));
+  EXPECT_EQ(1, message.count);
+  EXPECT_TRUE(subscriber_1->read(message));
+  EXPECT_EQ(2, message.count);
+  EXPECT_FALSE(subscriber_1->read(message));
+
+  EXPECT_TRUE(subscriber_2->read(message));
+  EXPECT_EQ(1, message.count);
+  EXPECT_EQ(0.5, message.value);
+}
+
+DESCRIBE_F(BASE_BroadcastTest, write, should_skip_overwritten_messages, if_reader_is_slow) {
+  Topic topic("topic", 2, Topic::SlowReader::OVERWRITE);
+  auto subscriber = std::make_shared<BroadcastSubscriber<Message>>("subscriber");
+  EXPECT_TRUE(topic.subscribe(subscriber));
+
+  for (int count = 1; count <= 5; ++count) {
+    EXPECT_TRUE(topic.write({count, 0.0}));
+  }
+
+  Message message;
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(4, message.count);
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(5, message.count);
+  EXPECT_FALSE(subscriber->read(message));
+  EXPECT_EQ(3u, subscriber->getMissed());
+}
+
+DESCRIBE_F(BASE_BroadcastTest, write, should_return_false, if_reader_is_slow_and_rejected) {
+  Topic topic("topic", 2, Topic::SlowReader::REJECT);
+  auto fast = std::make_shared<BroadcastSubscriber<Message>>("fast");
+  auto slow = std::make_shared<BroadcastSubscriber<Message>>("slow");
+  EXPECT_TRUE(topic.subscribe(fast));
+  EXPECT_TRUE(topic.subscribe(slow));
+
+  Message message;
+  EXPECT_TRUE(topic.write({1, 0.0}));
+  EXPECT_TRUE(topic.write({2, 0.0}));
+  EXPECT_TRUE(fast->read(message));
+  EXPECT_FALSE(topic.write({3, 0.0}));
+
+  EXPECT_TRUE(slow->read(message));
+  EXPECT_EQ(1, message.count);
+  EXPECT_TRUE(topic.write({3, 0.0}));
+  EXPECT_EQ(0u, slow->getMissed());
+}
+
+DESCRIBE_F(BASE_BroadcastTest, write, should_write_batch_up_to_slowest_reader) {
+  LoopMock mock;
+  Topic topic("topic", 3, Topic::SlowReader::REJECT);
+  auto subscriber = std::make_shared<BroadcastSubscriber<Message>>("subscriber", &mock);
+  EXPECT_TRUE(topic.subscribe(subscriber));
+
+  Message messages[4]{{1, 0.0}, {2, 0.0}, {3, 0.0}, {4, 0.0}};
+  EXPECT_CALL(mock, wake());
+  EXPECT_EQ(3u, topic.write(messages, 4));
+  EXPECT_EQ(0u, topic.write(messages, 4));
+
+  Message message;
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(1, message.count);
+}
+
+DESCRIBE_F(BASE_BroadcastTest, read, should_return_false, if_not_subscribed) {
+  BroadcastSubscriber<Message> subscriber("subscriber");
+  Message message;
+  EXPECT_FALSE(subscriber.read(message));
+}
+
+}  // namespace fdl::test::broadcast
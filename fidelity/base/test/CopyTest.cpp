@@ -0,0 +1,88 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Definitions.hpp"
+
+#include "../Copy.hpp"
+#include "../SpscQueue.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::copy {
+
+// large trivially copyable message
+struct Frame {
+  uint32_t sequence;
+  uint8_t pixels[4096];
+};
+
+class BASE_CopyTest : public t::Test {
+ protected:
+  static std::vector<uint8_t> pattern(size_t size) {
+    std::vector<uint8_t> data(size);
+    for (size_t index = 0; index < size; ++index) {
+      data[index] = static_cast<uint8_t>(index * 7 + 3);
+    }
+    return data;
+  }
+};
+
+DESCRIBE_F(BASE_CopyTest, copy, should_copy_all_bytes, if_buffers_are_unaligned) {
+  const size_t sizes[]{0, 1, 63, fdl::copy::BULK_SIZE - 1, fdl::copy::BULK_SIZE + 65, 100000};
+  EXPECT_EQ(0u, fdl::copy::getNonTemporalSize());
+  // copy with memcpy only and with non temporal stores from BULK_SIZE on
+  for (size_t non_temporal_size : {size_t{0}, fdl::copy::BULK_SIZE}) {
+    fdl::copy::setNonTemporalSize(non_temporal_size);
+    EXPECT_EQ(non_temporal_size, fdl::copy::getNonTemporalSize());
+    for (size_t size : sizes) {
+      for (size_t offset : {0, 1, 17, 31}) {
+        const std::vector<uint8_t> source = pattern(size + offset);
+        std::vector<uint8_t> destination(size + 2 * offset + 1, 0xAA);
+        fdl::copy::copy(destination.data() + offset, source.data() + offset / 2, size);
+        EXPECT_TRUE(std::equal(source.begin() + offset / 2, source.begin() + offset / 2 + size,
+                               destination.begin() + offset))
+            << "size " << size << " offset " << offset;
+        // bytes around destination are untouched
+        EXPECT_EQ(0xAA, destination[offset + size]);
+        if (offset > 0) {
+          EXPECT_EQ(0xAA, destination[offset - 1]);
+        }
+      }
+    }
+  }
+  fdl::copy::setNonTemporalSize(0);
+}
+
+DESCRIBE_F(BASE_CopyTest, construct, should_construct_message) {
+  auto frame = std::make_unique<Frame>();
+  frame->sequence = 42;
+  const std::vector<uint8_t> pixels = pattern(sizeof(frame->pixels));
+  std::copy(pixels.begin(), pixels.end(), frame->pixels);
+
+  SpscQueue<Frame> queue(2);
+  EXPECT_TRUE(queue.push(*frame));
+  EXPECT_EQ(1u, queue.push(frame.get(), 1));
+
+  auto read_frame = std::make_unique<Frame>();
+  for (int count = 0; count < 2; ++count) {
+    EXPECT_TRUE(queue.pop(*read_frame));
+    EXPECT_EQ(42u, read_frame->sequence);
+    EXPECT_TRUE(std::equal(pixels.begin(), pixels.end(), read_frame->pixels));
+  }
+
+  // other messages are constructed by placement new
+  std::aligned_storage_t<sizeof(std::string), alignof(std::string)> storage;
+  auto* message = reinterpret_cast<std::string*>(&storage);  // NOLINT
+  fdl::copy::construct(message, 3, 'a');
+  EXPECT_EQ("aaa", *message);
+  message->~basic_string();
+}
+
+}  // namespace fdl::test::copy
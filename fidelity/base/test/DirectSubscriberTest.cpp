@@ -0,0 +1,47 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Definitions.hpp"
+
+#include "../DirectSubscriber.hpp"
+#include "../Publisher.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::direct_subscriber {
+
+class BASE_DirectSubscriberTest : public t::Test {};
+
+DESCRIBE_F(BASE_DirectSubscriberTest, constructor, should_check_precondidtions) {
+  // expect non empty name
+  EXPECT_THROW(DirectSubscriber<int>("", [](int /*message*/) {}),
+               std::experimental::contract_violation_error);
+  // expect callback
+  EXPECT_THROW(DirectSubscriber<int>("subscriber", nullptr),
+               std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_DirectSubscriberTest, write, should_call_callback_for_each_message) {
+  std::vector<int> received;
+  Publisher<int> publisher("publisher");
+  auto subscriber = std::make_shared<DirectSubscriber<int>>(
+      "subscriber", [&received](int message) { received.push_back(message); });
+  EXPECT_EQ("subscriber", subscriber->getName());
+  EXPECT_TRUE(publisher.subscribe(subscriber));
+
+  EXPECT_TRUE(publisher.write(1));
+  int message = 2;
+  EXPECT_TRUE(publisher.write(message));
+  int messages[2]{3, 4};
+  EXPECT_TRUE(publisher.write(messages, 2));
+
+  EXPECT_EQ(std::vector<int>({1, 2, 3, 4}), received);
+}
+
+}  // namespace fdl::test::direct_subscriber
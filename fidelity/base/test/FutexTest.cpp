@@ -0,0 +1,57 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../Futex.hpp"
+
+using namespace std::chrono_literals;
+
+namespace t = testing;
+
+namespace fdl::test::futex {
+
+class BASE_FutexTest : public t::Test {};
+
+DESCRIBE_F(BASE_FutexTest, waitFor, should_return_immediately, if_value_changed) {
+  std::atomic<uint32_t> word{1};
+  EXPECT_TRUE(fdl::futex::waitFor(word, 0, 1s));
+  EXPECT_TRUE(fdl::futex::waitFor(word, 0, 0ns));
+}
+
+DESCRIBE_F(BASE_FutexTest, waitFor, should_return_false, if_timeout_elapsed) {
+  std::atomic<uint32_t> word{0};
+  EXPECT_FALSE(fdl::futex::waitFor(word, 0, 1ms));
+  EXPECT_FALSE(fdl::futex::waitFor(word, 0, 0ns));
+}
+
+DESCRIBE_F(BASE_FutexTest, waitUntil, should_return_false, if_deadline_reached) {
+  std::atomic<uint32_t> word{0};
+  const auto deadline = std::chrono::steady_clock::now() + 1ms;
+  EXPECT_FALSE(fdl::futex::waitUntil(word, 0, deadline));
+  EXPECT_GE(std::chrono::steady_clock::now(), deadline);
+
+  word.store(1);
+  EXPECT_TRUE(fdl::futex::waitUntil(word, 0, deadline));
+}
+
+DESCRIBE_F(BASE_FutexTest, wake, should_wake_waiting_thread) {
+  std::atomic<uint32_t> word{0};
+  std::thread waiter([&word] {
+    while (word.load() == 0) {
+      fdl::futex::wait(word, 0);
+    }
+  });
+  std::this_thread::sleep_for(1ms);
+  word.store(1);
+  fdl::futex::wake(word, 1);
+  waiter.join();
+  EXPECT_EQ(0, fdl::futex::wake(word, 1));
+}
+
+}  // namespace fdl::test::futex
@@ -0,0 +1,111 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <chrono>
+#include <memory>
+
+#include "Definitions.hpp"
+
+#include "../LatencyHistogram.hpp"
+#include "../Publisher.hpp"
+#include "../Stamped.hpp"
+#include "../Subscriber.hpp"
+
+using namespace std::chrono_literals;
+
+namespace t = testing;
+
+namespace fdl::test::latency_histogram {
+
+class BASE_LatencyHistogramTest : public t::Test {};
+
+DESCRIBE_F(BASE_LatencyHistogramTest, getPercentile, should_check_precondidtions) {
+  LatencyHistogram histogram;
+  // expect percentile between 0 and 100
+  EXPECT_THROW(histogram.getPercentile(-1.0), std::experimental::contract_violation_error);
+  EXPECT_THROW(histogram.getPercentile(100.1), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_LatencyHistogramTest, getPercentile, should_return_0, if_nothing_was_recorded) {
+  LatencyHistogram histogram;
+  EXPECT_EQ(0u, histogram.getCount());
+  EXPECT_EQ(0ns, histogram.getPercentile(50.0));
+  EXPECT_EQ(0ns, histogram.getMax());
+}
+
+DESCRIBE_F(BASE_LatencyHistogramTest, getPercentile, should_return_recorded_latencies) {
+  LatencyHistogram histogram;
+  for (int latency = 1; latency <= 100; ++latency) {
+    histogram.record(std::chrono::nanoseconds(latency));
+  }
+  histogram.record(-5ns);
+
+  EXPECT_EQ(101u, histogram.getCount());
+  EXPECT_EQ(100ns, histogram.getMax());
+  EXPECT_EQ(0ns, histogram.getPercentile(0.0));
+  EXPECT_EQ(50ns, histogram.getPercentile(50.0));
+  EXPECT_EQ(100ns, histogram.getPercentile(100.0));
+}
+
+DESCRIBE_F(BASE_LatencyHistogramTest, getPercentile, should_keep_relative_precision) {
+  LatencyHistogram histogram;
+  histogram.record(100us);
+  histogram.record(10s);
+
+  const auto median = histogram.getPercentile(50.0);
+  EXPECT_LE(100us, median);
+  EXPECT_GE(100us * 1.04, median);
+  EXPECT_EQ(10s, histogram.getPercentile(99.9));
+
+  histogram.reset();
+  EXPECT_EQ(0u, histogram.getCount());
+  EXPECT_EQ(0ns, histogram.getPercentile(99.9));
+}
+
+DESCRIBE_F(BASE_LatencyHistogramTest, record, should_record_latency_of_stamped_messages) {
+  LatencyHistogram histogram;
+  Publisher<Stamped<int>> publisher("publisher");
+  auto subscriber = std::make_shared<Subscriber<Stamped<int>>>("subscriber", 4);
+  subscriber->setLatencyHistogram(&histogram);
+  EXPECT_TRUE(publisher.subscribe(subscriber));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_TRUE(publisher.write(Stamped<int>{1, {}}));
+  EXPECT_TRUE(publisher.write(Stamped<int>{2, {}}));
+  EXPECT_TRUE(publisher.write(Stamped<int>{3, {}}));
+
+  Stamped<int> message;
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(1, message.message);
+  EXPECT_LE(start, message.stamp);
+  EXPECT_EQ(2u, subscriber->readAll([](const Stamped<int>& /*message*/) {}));
+
+  EXPECT_EQ(3u, histogram.getCount());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, histogram.getMax());
+}
+
+DESCRIBE_F(BASE_LatencyHistogramTest, record, should_skip_unstamped_messages_of_batches) {
+  LatencyHistogram histogram;
+  Publisher<Stamped<int>> publisher("publisher");
+  auto subscriber = std::make_shared<Subscriber<Stamped<int>>>("subscriber", 4);
+  subscriber->setLatencyHistogram(&histogram);
+  EXPECT_TRUE(publisher.subscribe(subscriber));
+
+  const auto start = std::chrono::steady_clock::now();
+  const Stamped<int> messages[3]{{1, {}}, {2, start}, {3, {}}};
+  EXPECT_TRUE(publisher.write(messages, 3));
+
+  Stamped<int> read_messages[3];
+  EXPECT_EQ(3u, subscriber->read(read_messages, 3));
+  EXPECT_EQ(1u, histogram.getCount());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, histogram.getMax());
+
+  EXPECT_TRUE(publisher.write(messages, 3));
+  EXPECT_EQ(3u, subscriber->readAll([](const Stamped<int>& /*message*/) {}));
+  EXPECT_EQ(2u, histogram.getCount());
+  EXPECT_GE(std::chrono::steady_clock::now() - start, histogram.getMax());
+}
+
+}  // namespace fdl::test::latency_histogram
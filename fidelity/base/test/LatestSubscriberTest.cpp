@@ -0,0 +1,85 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <string>
+
+#include "Definitions.hpp"
+#include "LoopMock.hpp"
+
+#include "../LatestSubscriber.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::latest_subscriber {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+class BASE_LatestSubscriberTest : public t::Test {};
+
+DESCRIBE_F(BASE_LatestSubscriberTest, constructor, should_check_precondidtions) {
+  // expect non empty name
+  EXPECT_THROW(LatestSubscriber<Message>(""), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_LatestSubscriberTest, getName, should_return_name) {
+  LatestSubscriber<Message> subscriber("subscriber");
+  EXPECT_EQ(std::string("subscriber"), subscriber.getName());
+}
+
+DESCRIBE_F(BASE_LatestSubscriberTest, write, should_wake_loop_and_never_fail) {
+  LoopMock mock;
+  LatestSubscriber<Message> subscriber("subscriber", &mock);
+
+  EXPECT_CALL(mock, wake()).Times(3);
+  EXPECT_TRUE(subscriber.write({1, 0.5}));
+  EXPECT_TRUE(subscriber.write({2, 1.5}));
+  EXPECT_TRUE(subscriber.write({3, 2.5}));
+}
+
+DESCRIBE_F(BASE_LatestSubscriberTest, read, should_receive_newest_message) {
+  LatestSubscriber<Message> subscriber("subscriber");
+
+  Message message;
+  for (int count = 1; count <= 5; ++count) {
+    EXPECT_TRUE(subscriber.write({count, 0.5}));
+  }
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(5, message.count);
+
+  EXPECT_TRUE(subscriber.write({6, 1.5}));
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(6, message.count);
+  EXPECT_EQ(1.5, message.value);
+}
+
+DESCRIBE_F(BASE_LatestSubscriberTest, write, should_store_last_message_of_batch) {
+  LatestSubscriber<Message> subscriber("subscriber");
+
+  Message messages[3]{{1, 0.5}, {2, 1.5}, {3, 2.5}};
+  EXPECT_EQ(3u, subscriber.write(messages, 3));
+
+  Message message;
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(3, message.count);
+  EXPECT_FALSE(subscriber.read(message));
+}
+
+DESCRIBE_F(BASE_LatestSubscriberTest, read, should_return_false, if_no_new_message_was_written) {
+  LatestSubscriber<Message> subscriber("subscriber");
+
+  Message message;
+  EXPECT_FALSE(subscriber.read(message));
+
+  EXPECT_TRUE(subscriber.write({1, 0.5}));
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_FALSE(subscriber.read(message));
+  EXPECT_EQ(1, message.count);
+}
+
+}  // namespace fdl::test::latest_subscriber
@@ -11,6 +11,7 @@ class LoopMock : public ILoop {
   virtual ~LoopMock() = default;
 
   MOCK_METHOD1(setPeriod, void(std::chrono::microseconds));
+  MOCK_METHOD1(setEventTriggered, void(bool));
   MOCK_METHOD1(setStackSize, void(size_t));
   MOCK_METHOD0(configure, bool());
   MOCK_METHOD0(start, bool());
@@ -5,6 +5,7 @@
 
 #include <chrono>
 #include <memory>
+#include <stdexcept>
 
 #include "Definitions.hpp"
 #include "ThreadMock.hpp"
@@ -71,6 +72,17 @@ DESCRIBE_F(BASE_LoopTest, setPeriod, should_set_loop_period) {
   loop.setPeriod(1000us);
 }
 
+DESCRIBE_F(BASE_LoopTest, setEventTriggered, should_set_event_triggering) {
+  auto thread_mock = std::make_shared<ThreadMock>();
+  injectThread(thread_mock);
+
+  RTLoop loop("rt_loop");
+  EXPECT_THROW(loop.setEventTriggered(false), std::experimental::contract_violation_error);
+  EXPECT_TRUE(loop.configure());
+  EXPECT_CALL(*thread_mock, setEventTriggered(false));
+  loop.setEventTriggered(false);
+}
+
 DESCRIBE_F(BASE_LoopTest, setStackSize, should_set_stack_size) {
   auto thread_mock = std::make_shared<ThreadMock>();
   injectThread(thread_mock);
@@ -146,6 +158,27 @@ DESCRIBE_F(BASE_LoopTest, start, should_call_onStart) {
   EXPECT_CALL(*thread_mock, join());
 }
 
+DESCRIBE_F(BASE_LoopTest, start, should_be_retryable, if_thread_creation_failed) {
+  auto thread_mock = std::make_shared<ThreadMock>();
+  injectThread(thread_mock);
+
+  TestRTLoop loop;
+  EXPECT_CALL(loop, onConfigure()).WillOnce(t::Return(true));
+  EXPECT_TRUE(loop.configure());
+
+  EXPECT_CALL(loop, onStart()).Times(2).WillRepeatedly(t::Return(true));
+  EXPECT_CALL(*thread_mock, create())
+      .WillOnce(t::Throw(std::runtime_error("create failed")))
+      .WillOnce(t::Return());
+  EXPECT_THROW(loop.start(), std::runtime_error);
+  EXPECT_THROW(loop.wake(), std::experimental::contract_violation_error);
+  EXPECT_TRUE(loop.start());
+
+  // called by destructor
+  EXPECT_CALL(*thread_mock, stop());
+  EXPECT_CALL(*thread_mock, join());
+}
+
 DESCRIBE_F(BASE_LoopTest, wake, should_wake_thread) {
   auto thread_mock = std::make_shared<ThreadMock>();
   injectThread(thread_mock);
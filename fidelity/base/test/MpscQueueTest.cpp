@@ -0,0 +1,116 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "Definitions.hpp"
+
+#include "../MpscQueue.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::mpsc_queue {
+
+class BASE_MpscQueueTest : public t::Test {};
+
+DESCRIBE_F(BASE_MpscQueueTest, constructor, should_check_precondidtions) {
+  // expect capacity greater than 0
+  EXPECT_THROW(MpscQueue<int>(0), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_MpscQueueTest, push, should_return_false, if_queue_is_full) {
+  MpscQueue<std::string> queue(3);
+  EXPECT_TRUE(queue.push("a"));
+  EXPECT_TRUE(queue.push("b"));
+  EXPECT_TRUE(queue.push("c"));
+  EXPECT_FALSE(queue.push("d"));
+  EXPECT_EQ(3u, queue.read_available());
+
+  std::string message;
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("a", message);
+  EXPECT_TRUE(queue.push("d"));
+  for (auto expected : {"b", "c", "d"}) {
+    EXPECT_TRUE(queue.pop(message));
+    EXPECT_EQ(expected, message);
+  }
+  EXPECT_FALSE(queue.pop(message));
+}
+
+DESCRIBE_F(BASE_MpscQueueTest, push, should_push_whole_batch_or_nothing) {
+  MpscQueue<int> queue(4);
+  int messages[5]{1, 2, 3, 4, 5};
+  EXPECT_EQ(0u, queue.push(messages, 5));
+  EXPECT_EQ(3u, queue.push(messages, 3));
+  EXPECT_EQ(0u, queue.push(messages, 2));
+
+  int read_messages[2]{};
+  EXPECT_EQ(2u, queue.pop(read_messages, 2));
+  EXPECT_EQ(2, read_messages[1]);
+  EXPECT_EQ(2u, queue.push(messages + 3, 2));
+
+  int sum = 0;
+  EXPECT_EQ(3u, queue.consume_all([&sum](int message) { sum += message; }));
+  EXPECT_EQ(12, sum);
+}
+
+DESCRIBE_F(BASE_MpscQueueTest, emplace, should_construct_message_in_queue) {
+  MpscQueue<std::string> queue(2);
+  EXPECT_TRUE(queue.emplace(3, 'a'));
+  EXPECT_TRUE(queue.push(std::string("b")));
+  EXPECT_FALSE(queue.emplace(1, 'c'));
+
+  std::string message;
+  EXPECT_TRUE(queue.consume_one([&message](std::string& queued) { message = std::move(queued); }));
+  EXPECT_EQ("aaa", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_FALSE(queue.consume_one([](std::string& /*queued*/) {}));
+}
+
+DESCRIBE_F(BASE_MpscQueueTest, destructor, should_destroy_queued_messages) {
+  auto message = std::make_shared<int>(1);
+  {
+    MpscQueue<std::shared_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.push(message));
+    EXPECT_EQ(2, message.use_count());
+  }
+  EXPECT_EQ(1, message.use_count());
+}
+
+DESCRIBE_F(BASE_MpscQueueTest, pop, should_keep_order_of_each_producer) {
+  constexpr int count = 50000;
+  MpscQueue<std::pair<int, int>> queue(8);
+
+  auto produce = [&queue](int producer) {
+    for (int value = 1; value <= count;) {
+      if (queue.push({producer, value})) {
+        ++value;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  };
+  std::thread producer_0(produce, 0);
+  std::thread producer_1(produce, 1);
+
+  int last[2]{0, 0};
+  std::pair<int, int> message;
+  while (last[0] < count || last[1] < count) {
+    if (queue.pop(message)) {
+      EXPECT_EQ(last[message.first] + 1, message.second);
+      last[message.first] = message.second;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer_0.join();
+  producer_1.join();
+}
+
+}  // namespace fdl::test::mpsc_queue
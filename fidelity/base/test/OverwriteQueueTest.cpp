@@ -0,0 +1,106 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <string>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../OverwriteQueue.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::overwrite_queue {
+
+class BASE_OverwriteQueueTest : public t::Test {};
+
+DESCRIBE_F(BASE_OverwriteQueueTest, constructor, should_check_precondidtions) {
+  // expect capacity greater than 0
+  EXPECT_THROW(OverwriteQueue<int>(0), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_OverwriteQueueTest, pop, should_return_messages_in_order) {
+  OverwriteQueue<std::string> queue(3);
+  EXPECT_TRUE(queue.push("a"));
+  EXPECT_TRUE(queue.push("b"));
+  EXPECT_EQ(2u, queue.read_available());
+
+  std::string message;
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("a", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_FALSE(queue.pop(message));
+}
+
+DESCRIBE_F(BASE_OverwriteQueueTest, push, should_drop_oldest_message, if_queue_is_full) {
+  OverwriteQueue<std::string> queue(2);
+  for (auto message : {"a", "b", "c", "d", "e"}) {
+    EXPECT_TRUE(queue.push(message));
+  }
+  EXPECT_EQ(2u, queue.read_available());
+
+  std::string message;
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("d", message);
+  EXPECT_TRUE(queue.push("f"));
+  EXPECT_TRUE(queue.push("g"));
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("f", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("g", message);
+  EXPECT_FALSE(queue.pop(message));
+}
+
+DESCRIBE_F(BASE_OverwriteQueueTest, emplace, should_move_message_into_queue) {
+  OverwriteQueue<std::string> queue(1);
+  EXPECT_TRUE(queue.emplace(3, 'a'));
+  EXPECT_TRUE(queue.push(std::string("b")));
+
+  std::string message;
+  EXPECT_TRUE(queue.consume_one([&message](std::string& queued) { message = std::move(queued); }));
+  EXPECT_EQ("b", message);
+  EXPECT_FALSE(queue.consume_one([](std::string& /*queued*/) {}));
+}
+
+DESCRIBE_F(BASE_OverwriteQueueTest, push, should_keep_latest_messages_of_batch) {
+  OverwriteQueue<int> queue(3);
+  int messages[5]{1, 2, 3, 4, 5};
+  EXPECT_EQ(2u, queue.push(messages, 2));
+  EXPECT_EQ(5u, queue.push(messages, 5));
+  EXPECT_EQ(3u, queue.read_available());
+
+  int read_messages[4]{};
+  EXPECT_EQ(3u, queue.pop(read_messages, 4));
+  EXPECT_EQ(3, read_messages[0]);
+  EXPECT_EQ(4, read_messages[1]);
+  EXPECT_EQ(5, read_messages[2]);
+}
+
+DESCRIBE_F(BASE_OverwriteQueueTest, pop, should_keep_order, if_producer_overwrites_concurrently) {
+  constexpr int count = 100000;
+  OverwriteQueue<int> queue(4);
+
+  std::thread producer([&queue] {
+    for (int value = 1; value <= count; ++value) {
+      queue.push(value);
+    }
+  });
+
+  int last = 0;
+  int value = 0;
+  while (last < count) {
+    if (queue.pop(value)) {
+      EXPECT_LT(last, value);
+      last = value;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+  EXPECT_EQ(count, last);
+}
+
+}  // namespace fdl::test::overwrite_queue
@@ -3,13 +3,19 @@
 
 #include <contract/contract_assert.hpp>
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Definitions.hpp"
+#include "LoopMock.hpp"
 #include "SubscriberMock.hpp"
 
 #include "../Publisher.hpp"
+#include "../Subscriber.hpp"
 
 namespace t = testing;
 
@@ -34,6 +40,33 @@ struct Message {
   }
 };
 
+// subscriber counting written messages
+class CountingSubscriber : public ISubscriber<Message> {
+ public:
+  explicit CountingSubscriber(const std::string& name) : m_name(name) {}
+
+  const std::string& getName() const override {
+    return m_name;
+  }
+
+  bool write(const Message& /*message*/) override {
+    m_count++;
+    return true;
+  }
+
+  size_t write(const Message* /*messages*/, size_t size) override {
+    m_count += size;
+    return size;
+  }
+
+  using ISubscriber<Message>::write;
+
+  std::atomic<size_t> m_count{0};
+
+ private:
+  const std::string m_name;
+};
+
 class BASE_PublisherTest : public t::Test {};
 
 DESCRIBE_F(BASE_PublisherTest, constructor, should_check_precondidtions) {
@@ -96,4 +129,206 @@ DESCRIBE_F(BASE_PublisherTest, write, should_publish_message_to_subscribers) {
   EXPECT_TRUE(publisher.write(message));
 }
 
+DESCRIBE_F(BASE_PublisherTest, write, should_move_message_into_last_subscriber) {
+  Publisher<std::vector<int>> publisher("publisher");
+  auto subscriber_1 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_1");
+  auto subscriber_2 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_2");
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  std::vector<int> message{1, 2, 3};
+  const int* storage = message.data();
+  EXPECT_TRUE(publisher.write(std::move(message)));
+  EXPECT_TRUE(publisher.emplace(2, 4));
+
+  std::vector<int> read_message;
+  EXPECT_TRUE(subscriber_1->read(read_message));
+  EXPECT_EQ(std::vector<int>({1, 2, 3}), read_message);
+  EXPECT_NE(storage, read_message.data());
+  EXPECT_TRUE(subscriber_2->read(read_message));
+  EXPECT_EQ(storage, read_message.data());
+
+  EXPECT_TRUE(subscriber_2->read(read_message));
+  EXPECT_EQ(std::vector<int>({4, 4}), read_message);
+}
+
+DESCRIBE_F(BASE_PublisherTest, getStatistics, should_count_writes_and_drops) {
+  Publisher<Message> publisher("publisher");
+  auto subscriber_1 = std::make_shared<Subscriber<Message>>("subscriber_1", 4);
+  auto subscriber_2 = std::make_shared<Subscriber<Message>>("subscriber_2", 2);
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  Message messages[3];
+  EXPECT_TRUE(publisher.write(messages[0]));
+  EXPECT_FALSE(publisher.write(messages, 3));
+
+  const Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(2u, statistics.writes);
+  EXPECT_EQ(2u, statistics.drops);
+  EXPECT_NE(std::chrono::steady_clock::time_point(), statistics.last_write);
+}
+
+DESCRIBE_F(BASE_PublisherTest, write, should_publish_batch_to_subscribers) {
+  Publisher<Message> publisher("publisher");
+
+  std::string subscriber_name_1 = "subscriber_1";
+  std::string subscriber_name_2 = "subscriber_2";
+  auto mock_1 = std::make_shared<SubscriberMock<Message>>();
+  auto mock_2 = std::make_shared<SubscriberMock<Message>>();
+  EXPECT_CALL(*mock_1, getName()).WillRepeatedly(t::ReturnRef(subscriber_name_1));
+  EXPECT_CALL(*mock_2, getName()).WillRepeatedly(t::ReturnRef(subscriber_name_2));
+  EXPECT_TRUE(publisher.subscribe(mock_1));
+  EXPECT_TRUE(publisher.subscribe(mock_2));
+
+  Message messages[2];
+  EXPECT_CALL(*mock_1, write(messages, 2)).WillOnce(t::Return(2));
+  EXPECT_CALL(*mock_2, write(messages, 2)).WillOnce(t::Return(2));
+  EXPECT_TRUE(publisher.write(messages, 2));
+
+  // should fail if a subscriber got full
+  EXPECT_CALL(*mock_1, write(messages, 2)).WillOnce(t::Return(2));
+  EXPECT_CALL(*mock_2, write(messages, 2)).WillOnce(t::Return(1));
+  EXPECT_FALSE(publisher.write(messages, 2));
+}
+
+DESCRIBE_F(BASE_PublisherTest, unsubscribe, should_stop_publishing_to_subscriber) {
+  Publisher<Message> publisher("publisher");
+  auto subscriber_1 = std::make_shared<CountingSubscriber>("subscriber_1");
+  auto subscriber_2 = std::make_shared<CountingSubscriber>("subscriber_2");
+
+  EXPECT_FALSE(publisher.unsubscribe(nullptr));
+  EXPECT_FALSE(publisher.unsubscribe(subscriber_1));
+
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+  EXPECT_TRUE(publisher.write(Message()));
+
+  EXPECT_TRUE(publisher.unsubscribe(subscriber_1));
+  EXPECT_FALSE(publisher.unsubscribe(subscriber_1));
+  EXPECT_TRUE(publisher.write(Message()));
+  EXPECT_EQ(1u, subscriber_1->m_count);
+  EXPECT_EQ(2u, subscriber_2->m_count);
+
+  // name can be used again
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.write(Message()));
+  EXPECT_EQ(2u, subscriber_1->m_count);
+  EXPECT_EQ(3u, subscriber_2->m_count);
+}
+
+DESCRIBE_F(BASE_PublisherTest, subscribe, should_be_possible, if_publisher_writes_concurrently) {
+  Publisher<Message> publisher("publisher");
+  auto permanent = std::make_shared<CountingSubscriber>("permanent");
+  auto temporary = std::make_shared<CountingSubscriber>("temporary");
+  EXPECT_TRUE(publisher.subscribe(permanent));
+
+  std::atomic<bool> running{true};
+  size_t written = 0;
+  std::thread writer([&] {
+    while (running) {
+      publisher.write(Message());
+      written++;
+      std::this_thread::yield();
+    }
+  });
+
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_TRUE(publisher.subscribe(temporary));
+    std::this_thread::yield();
+    EXPECT_TRUE(publisher.unsubscribe(temporary));
+  }
+  running = false;
+  writer.join();
+
+  EXPECT_EQ(written, permanent->m_count);
+  EXPECT_GE(written, temporary->m_count);
+}
+
+DESCRIBE_F(BASE_PublisherTest, writeFor, should_wait_for_free_space_in_subscribers) {
+  Publisher<Message> publisher("publisher");
+  auto subscriber_1 = std::make_shared<Subscriber<Message>>("subscriber_1", 1);
+  auto subscriber_2 = std::make_shared<Subscriber<Message>>("subscriber_2", 3);
+  subscriber_1->setBlockingWrites(true);
+  subscriber_2->setBlockingWrites(true);
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  Message message{'x', true, 1, 0.5f, 0.5};
+  EXPECT_TRUE(publisher.writeFor(message, std::chrono::milliseconds(0)));
+  EXPECT_FALSE(publisher.writeFor(message, std::chrono::milliseconds(1)));
+
+  std::thread reader([&subscriber_1] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    Message read_message;
+    EXPECT_TRUE(subscriber_1->read(read_message));
+  });
+  EXPECT_TRUE(publisher.writeFor(message, std::chrono::seconds(5)));
+  reader.join();
+
+  const Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(2u, statistics.writes);
+  EXPECT_EQ(1u, statistics.drops);
+}
+
+DESCRIBE_F(BASE_PublisherTest, write, should_write_only_accepted_messages, if_filter_is_set) {
+  Publisher<Message> publisher("publisher");
+  LoopMock mock;
+  auto subscriber_1 = std::make_shared<Subscriber<Message>>("subscriber_1", 4, &mock);
+  auto subscriber_2 = std::make_shared<Subscriber<Message>>("subscriber_2", 8);
+  EXPECT_TRUE(publisher.subscribe(subscriber_1,
+                                  [](const Message& message) { return message.name == 'a'; }));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  // rejected messages don't wake the loop
+  EXPECT_CALL(mock, wake()).Times(3);
+  EXPECT_TRUE(publisher.write(Message{'a', true, 1, 0.0f, 0.0}));
+  EXPECT_TRUE(publisher.write(Message{'b', true, 2, 0.0f, 0.0}));
+  Message messages[2]{{'b', true, 3, 0.0f, 0.0}, {'a', true, 4, 0.0f, 0.0}};
+  EXPECT_TRUE(publisher.write(messages, 2));
+  EXPECT_TRUE(publisher.writeFor(Message{'a', true, 5, 0.0f, 0.0}, std::chrono::seconds(0)));
+
+  Message message;
+  for (int count : {1, 4, 5}) {
+    EXPECT_TRUE(subscriber_1->read(message));
+    EXPECT_EQ(count, message.count);
+  }
+  EXPECT_FALSE(subscriber_1->read(message));
+  EXPECT_EQ(5u, subscriber_2->readAll([](const Message& /*message*/) {}));
+}
+
+DESCRIBE_F(BASE_PublisherTest, write, should_move_message_into_last_accepting_subscriber) {
+  Publisher<std::vector<int>> publisher("publisher");
+  auto subscriber_1 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_1");
+  auto subscriber_2 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_2");
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(
+      subscriber_2, [](const std::vector<int>& message) { return message.size() > 3; }));
+
+  std::vector<int> message{1, 2, 3};
+  const int* storage = message.data();
+  EXPECT_TRUE(publisher.write(std::move(message)));
+
+  std::vector<int> read_message;
+  EXPECT_FALSE(subscriber_2->read(read_message));
+  EXPECT_TRUE(subscriber_1->read(read_message));
+  EXPECT_EQ(storage, read_message.data());
+}
+
+DESCRIBE_F(BASE_PublisherTest, write, should_stop_writing_batch_to_filtered_subscriber, if_full) {
+  Publisher<Message> publisher("publisher");
+  auto subscriber = std::make_shared<Subscriber<Message>>("subscriber", 1);
+  EXPECT_TRUE(
+      publisher.subscribe(subscriber, [](const Message& message) { return message.valid; }));
+
+  Message messages[3]{{'a', false, 1, 0.0f, 0.0}, {'a', true, 2, 0.0f, 0.0},
+                      {'a', true, 3, 0.0f, 0.0}};
+  EXPECT_FALSE(publisher.write(messages, 3));
+  EXPECT_EQ(2u, publisher.getStatistics().writes);
+
+  Message message;
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(2, message.count);
+}
+
 }  // namespace fdl::test::publisher
@@ -0,0 +1,79 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "Definitions.hpp"
+
+#include "../RecordFile.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::record_file {
+
+// record with odd size, so records span chunk boundaries
+struct Record {
+  char data[1000];
+};
+
+class BASE_RecordFileTest : public t::Test {
+ protected:
+  void TearDown() override {
+    std::remove(m_path.c_str());
+  }
+
+  const std::string m_path{"/tmp/fidelity_record_file_" + std::to_string(getpid())};
+};
+
+DESCRIBE_F(BASE_RecordFileTest, constructor, should_check_precondidtions) {
+  // expect non empty path
+  EXPECT_THROW(RecordWriter("", 1), std::experimental::contract_violation_error);
+  EXPECT_THROW(RecordReader("", 1), std::experimental::contract_violation_error);
+  // expect record size greater than 0
+  EXPECT_THROW(RecordWriter(m_path, 0), std::experimental::contract_violation_error);
+  EXPECT_THROW(RecordReader(m_path, 0), std::experimental::contract_violation_error);
+  // expect chunk size greater than 0
+  EXPECT_THROW(RecordWriter(m_path, 1, 0), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_RecordFileTest, get, should_return_appended_records) {
+  RecordWriter writer(m_path, sizeof(Record), 4096);
+  Record record{};
+  EXPECT_FALSE(writer.append(&record));
+  ASSERT_TRUE(writer.open());
+  for (int index = 0; index < 20; ++index) {
+    std::memset(record.data, 'a' + index, sizeof(record.data));
+    EXPECT_TRUE(writer.append(&record));
+  }
+  EXPECT_EQ(20u, writer.getCount());
+  EXPECT_TRUE(writer.close());
+
+  RecordReader reader(m_path, sizeof(Record));
+  ASSERT_TRUE(reader.open());
+  ASSERT_EQ(20u, reader.getCount());
+  for (int index = 0; index < 20; ++index) {
+    std::memcpy(&record, reader.get(index), sizeof(record));
+    EXPECT_EQ('a' + index, record.data[0]);
+    EXPECT_EQ('a' + index, record.data[sizeof(record.data) - 1]);
+  }
+  EXPECT_THROW(reader.get(20), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_RecordFileTest, open, should_fail, if_record_size_does_not_match) {
+  RecordReader reader(m_path, sizeof(Record));
+  EXPECT_FALSE(reader.open());
+
+  RecordWriter writer(m_path, sizeof(Record) + 1);
+  ASSERT_TRUE(writer.open());
+  EXPECT_TRUE(writer.close());
+  EXPECT_FALSE(reader.open());
+  EXPECT_EQ(0u, reader.getCount());
+}
+
+}  // namespace fdl::test::record_file
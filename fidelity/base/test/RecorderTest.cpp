@@ -0,0 +1,110 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../Publisher.hpp"
+#include "../Recorder.hpp"
+#include "../Subscriber.hpp"
+
+using namespace std::chrono_literals;
+
+namespace t = testing;
+
+namespace fdl::test::recorder {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+class BASE_RecorderTest : public t::Test {
+ protected:
+  void TearDown() override {
+    std::remove(m_path.c_str());
+  }
+
+  /** Record messages with 2 ms between them. */
+  void record(int count) {
+    Publisher<Message> publisher("publisher");
+    auto recorder = std::make_shared<Recorder<Message>>("recorder", m_path, 4);
+    ASSERT_TRUE(recorder->open());
+    ASSERT_TRUE(publisher.subscribe(recorder));
+    for (int index = 0; index < count; ++index) {
+      EXPECT_TRUE(publisher.write({index, 0.5}));
+      EXPECT_EQ(1u, recorder->flush());
+      std::this_thread::sleep_for(2ms);
+    }
+    Message messages[2]{{count, 0.5}, {count + 1, 0.5}};
+    EXPECT_TRUE(publisher.write(messages, 2));
+    EXPECT_TRUE(recorder->close());
+  }
+
+  const std::string m_path{"/tmp/fidelity_recorder_" + std::to_string(getpid())};
+};
+
+DESCRIBE_F(BASE_RecorderTest, replay, should_publish_recorded_messages_as_fast_as_possible) {
+  record(3);
+
+  Replayer<Message> replayer(m_path);
+  ASSERT_TRUE(replayer.open());
+  ASSERT_EQ(5u, replayer.getCount());
+  EXPECT_LE(replayer.get(0).stamp + 4ms, replayer.get(2).stamp);
+
+  Publisher<Message> publisher("publisher");
+  auto subscriber = std::make_shared<Subscriber<Message>>("subscriber", 8);
+  EXPECT_TRUE(publisher.subscribe(subscriber));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(5u, replayer.replay(publisher, Replayer<Message>::Timing::AS_FAST_AS_POSSIBLE));
+  EXPECT_GT(4ms, std::chrono::steady_clock::now() - start);
+
+  Message message;
+  for (int index = 0; index < 5; ++index) {
+    EXPECT_TRUE(subscriber->read(message));
+    EXPECT_EQ(index, message.count);
+  }
+}
+
+DESCRIBE_F(BASE_RecorderTest, replay, should_keep_original_timing) {
+  record(3);
+
+  Replayer<Message> replayer(m_path);
+  ASSERT_TRUE(replayer.open());
+  Publisher<Message> publisher("publisher");
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(5u, replayer.replay(publisher));
+  const auto duration = std::chrono::steady_clock::now() - start;
+  EXPECT_LE(replayer.get(4).stamp - replayer.get(0).stamp, duration);
+}
+
+DESCRIBE_F(BASE_RecorderTest, open, should_fail, if_file_was_recorded_for_other_type) {
+  record(0);
+  Replayer<int> replayer(m_path);
+  EXPECT_FALSE(replayer.open());
+}
+
+DESCRIBE_F(BASE_RecorderTest, flush, should_count_lost_messages, if_file_is_not_open) {
+  Recorder<Message> recorder("recorder", m_path, 4);
+  EXPECT_TRUE(recorder.write({1, 0.5}));
+  EXPECT_TRUE(recorder.write({2, 0.5}));
+  EXPECT_EQ(0u, recorder.flush());
+  EXPECT_EQ(2u, recorder.getLostCount());
+
+  ASSERT_TRUE(recorder.open());
+  EXPECT_TRUE(recorder.write({3, 0.5}));
+  EXPECT_EQ(1u, recorder.flush());
+  EXPECT_EQ(2u, recorder.getLostCount());
+}
+
+}  // namespace fdl::test::recorder
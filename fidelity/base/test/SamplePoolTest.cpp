@@ -0,0 +1,82 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <utility>
+
+#include "Definitions.hpp"
+
+#include "../SamplePool.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::sample_pool {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double values[64]{};
+};
+
+class BASE_SamplePoolTest : public t::Test {};
+
+DESCRIBE_F(BASE_SamplePoolTest, constructor, should_check_precondidtions) {
+  // expect capacity greater than 0
+  EXPECT_THROW(SamplePool<Message>(0), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SamplePoolTest, loan, should_return_valid_sample) {
+  SamplePool<Message> pool(2);
+  EXPECT_EQ(2u, pool.available());
+
+  auto sample = pool.loan();
+  EXPECT_TRUE(sample);
+  EXPECT_EQ(1u, pool.available());
+
+  sample->count = 42;
+  EXPECT_EQ(42, (*sample).count);
+}
+
+DESCRIBE_F(BASE_SamplePoolTest, loan, should_return_empty_sample, if_pool_is_exhausted) {
+  SamplePool<Message> pool(1);
+  auto sample_1 = pool.loan();
+  auto sample_2 = pool.loan();
+  EXPECT_TRUE(sample_1);
+  EXPECT_FALSE(sample_2);
+  EXPECT_THROW(*sample_2, std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SamplePoolTest, copy, should_share_message) {
+  SamplePool<Message> pool(1);
+  auto sample = pool.loan();
+  auto copy = sample;
+  EXPECT_EQ(&*sample, &*copy);
+
+  Sample<Message> assigned;
+  EXPECT_FALSE(assigned);
+  assigned = copy;
+  EXPECT_EQ(&*sample, &*assigned);
+
+  auto moved = std::move(assigned);
+  EXPECT_FALSE(assigned);  // NOLINT
+  EXPECT_EQ(&*sample, &*moved);
+  EXPECT_EQ(0u, pool.available());
+}
+
+DESCRIBE_F(BASE_SamplePoolTest, release, should_return_slot, if_last_sample_is_destroyed) {
+  SamplePool<Message> pool(1);
+  {
+    auto sample = pool.loan();
+    {
+      auto copy = sample;
+      sample = Sample<Message>();
+      EXPECT_EQ(0u, pool.available());
+    }
+    EXPECT_EQ(1u, pool.available());
+  }
+  EXPECT_EQ(1u, pool.available());
+  EXPECT_TRUE(pool.loan());
+}
+
+}  // namespace fdl::test::sample_pool
@@ -0,0 +1,197 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <chrono>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../SharedMemory.hpp"
+#include "../SharedMemoryTopic.hpp"
+
+using namespace std::chrono_literals;
+
+namespace t = testing;
+
+namespace fdl::test::shared_memory {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+class BASE_SharedMemoryTest : public t::Test {
+ protected:
+  const std::string m_name{"/fidelity_test_" + std::to_string(getpid())};
+};
+
+DESCRIBE_F(BASE_SharedMemoryTest, constructor, should_check_precondidtions) {
+  // expect name with leading slash
+  EXPECT_THROW(SharedMemory("", 1), std::experimental::contract_violation_error);
+  EXPECT_THROW(SharedMemory("segment", 1), std::experimental::contract_violation_error);
+  EXPECT_THROW(SharedMemory("/seg/ment", 1), std::experimental::contract_violation_error);
+  // expect size greater than 0
+  EXPECT_THROW(SharedMemory(m_name, 0), std::experimental::contract_violation_error);
+  // expect capacity greater than 0
+  EXPECT_THROW(SharedMemorySender<Message>(m_name, 0),
+               std::experimental::contract_violation_error);
+  EXPECT_THROW(SharedMemoryReceiver<Message>(m_name, 0),
+               std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, open, should_map_segment_created_by_other_object) {
+  SharedMemory creator(m_name, 4096);
+  SharedMemory user(m_name, 4096);
+  SharedMemory too_large(m_name, 8192);
+
+  EXPECT_FALSE(user.open());
+  ASSERT_TRUE(creator.create());
+  ASSERT_TRUE(user.open());
+  EXPECT_FALSE(too_large.open());
+
+  std::strcpy(static_cast<char*>(creator.getData()), "shared");
+  EXPECT_STREQ("shared", static_cast<char*>(user.getData()));
+
+  // creator removes name of segment
+  creator.close();
+  EXPECT_EQ(nullptr, creator.getData());
+  EXPECT_NE(nullptr, user.getData());
+  EXPECT_FALSE(SharedMemory(m_name, 4096).open());
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, create, should_set_mode_regardless_of_umask) {
+  const mode_t mode = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH | S_IWOTH;
+  SharedMemorySender<Message> sender(m_name, 4, mode);
+  const mode_t umask = ::umask(S_IRWXG | S_IRWXO);
+  const bool created = sender.open();
+  ::umask(umask);
+  ASSERT_TRUE(created);
+
+  const int fd = ::shm_open(m_name.c_str(), O_RDONLY, 0);
+  ASSERT_LE(0, fd);
+  struct stat status {};
+  EXPECT_EQ(0, ::fstat(fd, &status));
+  ::close(fd);
+  EXPECT_EQ(mode, status.st_mode & (S_IRWXU | S_IRWXG | S_IRWXO));
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, open, should_fail, if_ring_does_not_match) {
+  SharedMemorySender<Message> sender(m_name, 4);
+  SharedMemoryReceiver<Message> receiver(m_name, 4);
+  SharedMemoryReceiver<Message> other_receiver(m_name, 2);
+
+  EXPECT_FALSE(receiver.open());
+  ASSERT_TRUE(sender.open());
+  EXPECT_FALSE(other_receiver.open());
+  EXPECT_TRUE(receiver.open());
+  EXPECT_EQ(m_name, sender.getName());
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, read, should_receive_written_messages) {
+  SharedMemorySender<Message> sender(m_name, 4);
+  SharedMemoryReceiver<Message> receiver(m_name, 4);
+
+  Message message{1, 0.5};
+  EXPECT_FALSE(sender.write(message));
+  ASSERT_TRUE(sender.open());
+  ASSERT_TRUE(receiver.open());
+
+  EXPECT_TRUE(sender.write(message));
+  Message messages[4]{{2, 1.0}, {3, 1.5}, {4, 2.0}, {5, 2.5}};
+  EXPECT_EQ(3u, sender.write(messages, 4));
+
+  Message read_message;
+  EXPECT_TRUE(receiver.read(read_message));
+  EXPECT_EQ(1, read_message.count);
+  Message read_messages[4];
+  EXPECT_EQ(3u, receiver.read(read_messages, 4));
+  EXPECT_EQ(4, read_messages[2].count);
+  EXPECT_FALSE(receiver.read(read_message));
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, wait, should_return, if_message_was_written) {
+  SharedMemorySender<Message> sender(m_name, 4);
+  SharedMemoryReceiver<Message> receiver(m_name, 4);
+  ASSERT_TRUE(sender.open());
+  ASSERT_TRUE(receiver.open());
+
+  EXPECT_FALSE(receiver.wait(1ms));
+
+  std::thread writer([&sender] {
+    std::this_thread::sleep_for(1ms);
+    EXPECT_TRUE(sender.write(Message{1, 0.5}));
+  });
+  EXPECT_TRUE(receiver.wait(10s));
+  writer.join();
+
+  Message read_message;
+  EXPECT_TRUE(receiver.read(read_message));
+  EXPECT_EQ(1, read_message.count);
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, write, should_clear_waiting_flag_of_lost_receiver) {
+  SharedMemorySender<Message> sender(m_name, 4);
+  ASSERT_TRUE(sender.open());
+
+  // receiver process was killed while waiting and never clears its flag
+  SharedMemory segment(m_name, sizeof(SharedMemoryRing));
+  ASSERT_TRUE(segment.open());
+  auto* ring = static_cast<SharedMemoryRing*>(segment.getData());
+  ring->waiting.store(1);
+
+  EXPECT_TRUE(sender.write(Message{1, 0.5}));
+  EXPECT_EQ(0u, ring->waiting.load());
+  const uint32_t signal = ring->signal.load();
+  EXPECT_TRUE(sender.write(Message{2, 1.0}));
+  EXPECT_EQ(signal, ring->signal.load());
+}
+
+DESCRIBE_F(BASE_SharedMemoryTest, read, should_detach, if_segment_was_replaced) {
+  auto sender = std::make_unique<SharedMemorySender<Message>>(m_name, 4);
+  auto new_sender = std::make_unique<SharedMemorySender<Message>>(m_name, 4);
+  SharedMemoryReceiver<Message> receiver(m_name, 4);
+  ASSERT_TRUE(sender->open());
+  ASSERT_TRUE(receiver.open());
+  EXPECT_TRUE(receiver.isConnected());
+  EXPECT_TRUE(sender->write(Message{1, 0.5}));
+
+  // remaining messages are read before the receiver detaches
+  ASSERT_TRUE(new_sender->open());
+  Message read_message;
+  EXPECT_TRUE(receiver.read(read_message));
+  EXPECT_EQ(1, read_message.count);
+  EXPECT_FALSE(receiver.read(read_message));
+  EXPECT_FALSE(receiver.isConnected());
+  EXPECT_FALSE(receiver.wait(1ms));
+
+  ASSERT_TRUE(receiver.open());
+  EXPECT_TRUE(new_sender->write(Message{2, 1.0}));
+  EXPECT_TRUE(receiver.read(read_message));
+  EXPECT_EQ(2, read_message.count);
+
+  // replaced sender doesn't remove segment of new sender
+  sender.reset();
+  EXPECT_TRUE(SharedMemoryReceiver<Message>(m_name, 4).open());
+
+  // destroyed sender wakes waiting receiver
+  std::thread closer([&new_sender] {
+    std::this_thread::sleep_for(1ms);
+    new_sender.reset();
+  });
+  EXPECT_FALSE(receiver.wait(10s));
+  closer.join();
+  EXPECT_FALSE(receiver.isConnected());
+}
+
+}  // namespace fdl::test::shared_memory
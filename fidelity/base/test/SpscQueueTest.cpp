@@ -0,0 +1,148 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../SpscQueue.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::spsc_queue {
+
+class BASE_SpscQueueTest : public t::Test {};
+
+DESCRIBE_F(BASE_SpscQueueTest, constructor, should_check_precondidtions) {
+  // expect capacity greater 0
+  EXPECT_THROW(SpscQueue<int>(0), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, push, should_return_false, if_queue_is_full) {
+  SpscQueue<std::string> queue(2);
+  EXPECT_TRUE(queue.push("a"));
+  EXPECT_TRUE(queue.push("b"));
+  EXPECT_FALSE(queue.push("c"));
+  EXPECT_EQ(2u, queue.read_available());
+
+  std::string message;
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("a", message);
+  EXPECT_TRUE(queue.push("c"));
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("c", message);
+  EXPECT_FALSE(queue.pop(message));
+  EXPECT_EQ(0u, queue.read_available());
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, push, should_push_batch_until_queue_is_full) {
+  SpscQueue<int> queue(4);
+  int messages[6]{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(4u, queue.push(messages, 6));
+
+  int read_messages[3]{};
+  EXPECT_EQ(3u, queue.pop(read_messages, 3));
+  EXPECT_EQ(3, read_messages[2]);
+
+  // batch wraps around end of ring
+  EXPECT_EQ(3u, queue.push(messages + 3, 3));
+  EXPECT_EQ(4u, queue.read_available());
+
+  int sum = 0;
+  EXPECT_EQ(4u, queue.consume_all([&sum](int message) { sum += message; }));
+  EXPECT_EQ(4 + 4 + 5 + 6, sum);
+  EXPECT_EQ(0u, queue.pop(read_messages, 3));
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, read_level, should_sample_level_on_reload_of_write_position) {
+  SpscQueue<int> queue(3);
+  int message = 0;
+  EXPECT_FALSE(queue.pop(message));
+  EXPECT_EQ(0u, queue.read_level());
+
+  int messages[3]{1, 2, 3};
+  EXPECT_EQ(3u, queue.push(messages, 3));
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ(3u, queue.read_level());
+  // cached write position still covers the remaining messages
+  EXPECT_TRUE(queue.push(4));
+  EXPECT_EQ(1u, queue.pop(messages, 1));
+  EXPECT_EQ(3u, queue.read_level());
+
+  EXPECT_EQ(2u, queue.pop(messages, 3));
+  EXPECT_EQ(2u, queue.read_level());
+  EXPECT_EQ(0u, queue.consume_all([](int /*message*/) {}));
+  EXPECT_EQ(0u, queue.read_level());
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, emplace, should_construct_message_in_queue) {
+  SpscQueue<std::string> queue(2);
+  EXPECT_TRUE(queue.emplace(3, 'a'));
+  EXPECT_TRUE(queue.push(std::string("b")));
+  EXPECT_FALSE(queue.emplace(1, 'c'));
+
+  std::string message;
+  EXPECT_TRUE(queue.consume_one([&message](std::string& queued) { message = std::move(queued); }));
+  EXPECT_EQ("aaa", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_FALSE(queue.consume_one([](std::string& /*queued*/) {}));
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, destructor, should_destroy_queued_messages) {
+  auto message = std::make_shared<int>(1);
+  {
+    SpscQueue<std::shared_ptr<int>> queue(2);
+    EXPECT_TRUE(queue.push(message));
+    EXPECT_EQ(2, message.use_count());
+  }
+  EXPECT_EQ(1, message.use_count());
+}
+
+DESCRIBE_F(BASE_SpscQueueTest, pop, should_keep_order, if_used_concurrently) {
+  constexpr int count = 100000;
+  SpscQueue<int> queue(7);
+
+  std::thread producer([&queue] {
+    int messages[3]{};
+    for (int value = 1; value <= count;) {
+      // alternate single and batch pushes
+      if (value % 2 == 0) {
+        messages[0] = value;
+        messages[1] = value + 1;
+        messages[2] = value + 2;
+        const size_t pushed = queue.push(messages, value + 2 <= count ? 3 : 1);
+        if (pushed == 0) {
+          std::this_thread::yield();
+        }
+        value += static_cast<int>(pushed);
+      } else if (queue.push(value)) {
+        ++value;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 1;
+  int values[4]{};
+  while (expected <= count) {
+    const size_t popped = queue.pop(values, 4);
+    for (size_t index = 0; index < popped; ++index) {
+      EXPECT_EQ(expected, values[index]);
+      ++expected;
+    }
+    if (popped == 0) {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+}
+
+}  // namespace fdl::test::spsc_queue
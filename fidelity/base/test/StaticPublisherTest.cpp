@@ -0,0 +1,89 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "Definitions.hpp"
+
+#include "../StaticPublisher.hpp"
+#include "../Subscriber.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::static_publisher {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+class BASE_StaticPublisherTest : public t::Test {};
+
+DESCRIBE_F(BASE_StaticPublisherTest, constructor, should_check_precondidtions) {
+  // expect non empty name
+  EXPECT_THROW(StaticPublisher<Message>(""), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_StaticPublisherTest, subscribe, should_return_false, if_subscriber_is_invalid) {
+  StaticPublisher<Message> publisher("publisher");
+  EXPECT_EQ("publisher", publisher.getName());
+  EXPECT_FALSE(publisher.subscribe(nullptr));
+  EXPECT_TRUE(publisher.subscribe(std::make_shared<Subscriber<Message>>("subscriber", 1)));
+  EXPECT_FALSE(publisher.subscribe(std::make_shared<Subscriber<Message>>("subscriber", 1)));
+}
+
+DESCRIBE_F(BASE_StaticPublisherTest, subscribe, should_fail, if_publisher_was_written) {
+  StaticPublisher<Message> publisher("publisher");
+  EXPECT_TRUE(publisher.write(Message{}));
+  EXPECT_THROW(publisher.subscribe(std::make_shared<Subscriber<Message>>("subscriber", 1)),
+               std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_StaticPublisherTest, write, should_publish_message_to_subscribers) {
+  StaticPublisher<Message> publisher("publisher");
+  auto subscriber_1 = std::make_shared<Subscriber<Message>>("subscriber_1", 4);
+  auto subscriber_2 = std::make_shared<Subscriber<Message>>("subscriber_2", 2);
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  const Message message{1, 0.5};
+  EXPECT_TRUE(publisher.write(message));
+  EXPECT_TRUE(publisher.write(Message{2, 0.5}));
+  Message messages[2]{{3, 0.5}, {4, 0.5}};
+  EXPECT_FALSE(publisher.write(messages, 2));
+
+  Message read_messages[4];
+  EXPECT_EQ(4u, subscriber_1->read(read_messages, 4));
+  EXPECT_EQ(4, read_messages[3].count);
+  EXPECT_EQ(2u, subscriber_2->read(read_messages, 4));
+  EXPECT_EQ(2, read_messages[1].count);
+
+  const Statistics statistics = publisher.getStatistics();
+  EXPECT_EQ(2u, statistics.writes);
+  EXPECT_EQ(2u, statistics.drops);
+}
+
+DESCRIBE_F(BASE_StaticPublisherTest, write, should_move_message_into_last_subscriber) {
+  StaticPublisher<std::vector<int>, StaticSubscriber<std::vector<int>, 2>> publisher("publisher");
+  auto subscriber_1 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_1");
+  auto subscriber_2 = std::make_shared<StaticSubscriber<std::vector<int>, 2>>("subscriber_2");
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  std::vector<int> message{1, 2, 3};
+  const int* storage = message.data();
+  EXPECT_TRUE(publisher.write(std::move(message)));
+
+  std::vector<int> read_message;
+  EXPECT_TRUE(subscriber_1->read(read_message));
+  EXPECT_NE(storage, read_message.data());
+  EXPECT_TRUE(subscriber_2->read(read_message));
+  EXPECT_EQ(storage, read_message.data());
+}
+
+}  // namespace fdl::test::static_publisher
@@ -0,0 +1,108 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+#include <thread>
+
+#include "Definitions.hpp"
+
+#include "../StaticQueue.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::static_queue {
+
+class BASE_StaticQueueTest : public t::Test {};
+
+DESCRIBE_F(BASE_StaticQueueTest, constructor, should_check_precondidtions) {
+  // expect matching capacity
+  EXPECT_THROW((StaticQueue<int, 4>(2)), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_StaticQueueTest, push, should_return_false, if_queue_is_full) {
+  StaticQueue<std::string, 2> queue;
+  EXPECT_TRUE(queue.push("a"));
+  EXPECT_TRUE(queue.push("b"));
+  EXPECT_FALSE(queue.push("c"));
+  EXPECT_EQ(2u, queue.read_available());
+
+  std::string message;
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("a", message);
+  EXPECT_TRUE(queue.push("c"));
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("c", message);
+  EXPECT_FALSE(queue.pop(message));
+}
+
+DESCRIBE_F(BASE_StaticQueueTest, push, should_push_batch_until_queue_is_full) {
+  StaticQueue<int, 4> queue;
+  int messages[6]{1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(4u, queue.push(messages, 6));
+
+  int read_messages[3]{};
+  EXPECT_EQ(3u, queue.pop(read_messages, 3));
+  EXPECT_EQ(3, read_messages[2]);
+
+  int sum = 0;
+  EXPECT_EQ(1u, queue.consume_all([&sum](int message) { sum += message; }));
+  EXPECT_EQ(4, sum);
+}
+
+DESCRIBE_F(BASE_StaticQueueTest, emplace, should_construct_message_in_queue) {
+  StaticQueue<std::string, 2> queue;
+  EXPECT_TRUE(queue.emplace(3, 'a'));
+  EXPECT_TRUE(queue.push(std::string("b")));
+  EXPECT_FALSE(queue.emplace(1, 'c'));
+
+  std::string message;
+  EXPECT_TRUE(queue.consume_one([&message](std::string& queued) { message = std::move(queued); }));
+  EXPECT_EQ("aaa", message);
+  EXPECT_TRUE(queue.pop(message));
+  EXPECT_EQ("b", message);
+  EXPECT_FALSE(queue.consume_one([](std::string& /*queued*/) {}));
+}
+
+DESCRIBE_F(BASE_StaticQueueTest, destructor, should_destroy_queued_messages) {
+  auto message = std::make_shared<int>(1);
+  {
+    StaticQueue<std::shared_ptr<int>, 2> queue;
+    EXPECT_TRUE(queue.push(message));
+    EXPECT_EQ(2, message.use_count());
+  }
+  EXPECT_EQ(1, message.use_count());
+}
+
+DESCRIBE_F(BASE_StaticQueueTest, pop, should_keep_order, if_used_concurrently) {
+  constexpr int count = 100000;
+  StaticQueue<int, 8> queue;
+
+  std::thread producer([&queue] {
+    for (int value = 1; value <= count;) {
+      if (queue.push(value)) {
+        ++value;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  int expected = 1;
+  int value = 0;
+  while (expected <= count) {
+    if (queue.pop(value)) {
+      EXPECT_EQ(expected, value);
+      ++expected;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+}
+
+}  // namespace fdl::test::static_queue
@@ -15,6 +15,7 @@ class SubscriberMock : public ISubscriber<MessageT> {
 
   MOCK_CONST_METHOD0(getName, const std::string&());
   MOCK_METHOD1_T(write, bool(const MessageT&));
+  MOCK_METHOD2_T(write, size_t(const MessageT*, size_t));
 };
 
 }  // namespace fdl::test
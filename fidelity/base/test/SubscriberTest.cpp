@@ -3,7 +3,12 @@
 
 #include <contract/contract_assert.hpp>
 
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <chrono>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Definitions.hpp"
 #include "LoopMock.hpp"
@@ -88,4 +93,382 @@ DESCRIBE_F(BASE_SubscriberTest, read, should_return_false, if_queue_is_empty) {
   EXPECT_FALSE(subscriber.read(message));
 }
 
+DESCRIBE_F(BASE_SubscriberTest, write, should_overwrite_oldest_message, if_queue_is_full) {
+  LoopMock mock;
+  OverwriteSubscriber<Message> subscriber("subscriber", 2, &mock);
+
+  EXPECT_CALL(mock, wake()).Times(3);
+  EXPECT_TRUE(subscriber.write({'a', false, 1, 0.5f, 0.5}));
+  EXPECT_TRUE(subscriber.write({'b', false, 2, 0.5f, 0.5}));
+  EXPECT_TRUE(subscriber.write({'c', false, 3, 0.5f, 0.5}));
+
+  Message read_message;
+  EXPECT_TRUE(subscriber.read(read_message));
+  EXPECT_EQ(2, read_message.count);
+  EXPECT_TRUE(subscriber.read(read_message));
+  EXPECT_EQ(3, read_message.count);
+  EXPECT_FALSE(subscriber.read(read_message));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_write_batch_and_wake_loop_once) {
+  LoopMock mock;
+  Subscriber<Message> subscriber("subscriber", 2, &mock);
+
+  Message messages[3]{{'a', false, 1, 0.5f, 0.5}, {'b', false, 2, 0.5f, 0.5}, {'c'}};
+  EXPECT_CALL(mock, wake());
+  EXPECT_EQ(2u, subscriber.write(messages, 3));
+
+  // nothing to wake for empty batch
+  EXPECT_EQ(0u, subscriber.write(messages, 0));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, read, should_read_batch) {
+  Subscriber<Message> subscriber("subscriber", 4);
+
+  Message messages[3]{{'a', false, 1, 0.5f, 0.5}, {'b', false, 2, 0.5f, 0.5}, {'c'}};
+  EXPECT_EQ(3u, subscriber.write(messages, 3));
+
+  Message read_messages[2];
+  EXPECT_EQ(2u, subscriber.read(read_messages, 2));
+  EXPECT_EQ(messages[0], read_messages[0]);
+  EXPECT_EQ(messages[1], read_messages[1]);
+  EXPECT_EQ(1u, subscriber.read(read_messages, 2));
+  EXPECT_EQ(messages[2], read_messages[0]);
+  EXPECT_EQ(0u, subscriber.read(read_messages, 2));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, readAll, should_call_functor_for_each_message) {
+  Subscriber<Message> subscriber("subscriber", 4);
+  OverwriteSubscriber<Message> overwrite_subscriber("overwrite_subscriber", 2);
+
+  Message messages[3]{{'a', false, 1}, {'b', false, 2}, {'c', false, 3}};
+  EXPECT_EQ(3u, subscriber.write(messages, 3));
+  EXPECT_EQ(3u, overwrite_subscriber.write(messages, 3));
+
+  int sum = 0;
+  auto add = [&sum](const Message& message) { sum += message.count; };
+  EXPECT_EQ(3u, subscriber.readAll(add));
+  EXPECT_EQ(6, sum);
+  EXPECT_EQ(0u, subscriber.readAll(add));
+
+  // oldest message was overwritten
+  sum = 0;
+  EXPECT_EQ(2u, overwrite_subscriber.readAll(add));
+  EXPECT_EQ(5, sum);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, read, should_receive_the_message, if_capacity_is_static) {
+  LoopMock mock;
+  StaticSubscriber<Message, 2> subscriber("subscriber", &mock);
+
+  Message message{'x', false, 1, 0.5f, 0.5};
+  Message read_message;
+  EXPECT_CALL(mock, wake()).Times(3);
+  EXPECT_TRUE(subscriber.write(message));
+  EXPECT_TRUE(subscriber.write(message));
+  EXPECT_FALSE(subscriber.write(message));
+  EXPECT_TRUE(subscriber.read(read_message));
+  EXPECT_EQ(message, read_message);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, emplace, should_construct_message_in_subscriber) {
+  LoopMock mock;
+  MpscSubscriber<std::vector<int>> subscriber("subscriber", 2, &mock);
+  // boost::lockfree::spsc_queue has no emplace
+  Subscriber<std::vector<int>, boost::lockfree::spsc_queue<std::vector<int>>> boost_subscriber(
+      "boost_subscriber", 2);
+
+  EXPECT_CALL(mock, wake());
+  EXPECT_TRUE(subscriber.emplace(3, 1));
+  EXPECT_TRUE(boost_subscriber.emplace(3, 1));
+
+  std::vector<int> message;
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(std::vector<int>({1, 1, 1}), message);
+  EXPECT_TRUE(boost_subscriber.read(message));
+  EXPECT_EQ(std::vector<int>({1, 1, 1}), message);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, read, should_move_message_out_of_subscriber) {
+  StaticSubscriber<std::vector<int>, 2> subscriber("subscriber");
+
+  std::vector<int> message{1, 2, 3};
+  const int* storage = message.data();
+  EXPECT_TRUE(subscriber.write(std::move(message)));
+
+  std::vector<int> read_message;
+  EXPECT_TRUE(subscriber.read(read_message));
+  EXPECT_EQ(storage, read_message.data());
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_accept_multiple_producers) {
+  MpscSubscriber<Message> subscriber("subscriber", 4);
+
+  std::thread producer([&subscriber] { EXPECT_TRUE(subscriber.write({'a', false, 1})); });
+  EXPECT_TRUE(subscriber.write({'b', false, 2}));
+  producer.join();
+
+  int sum = 0;
+  EXPECT_EQ(2u, subscriber.readAll([&sum](const Message& message) { sum += message.count; }));
+  EXPECT_EQ(3, sum);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, setWakePolicy, should_check_precondidtions) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  // expect threshold greater than 0
+  EXPECT_THROW(subscriber.setWakePolicy(WakePolicy::EVERY_N, 0),
+               std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_wake_loop_once_per_burst, if_policy_is_on_empty) {
+  LoopMock mock;
+  Subscriber<Message> subscriber("subscriber", 8, &mock);
+  subscriber.setWakePolicy(WakePolicy::ON_EMPTY);
+
+  Message message;
+  EXPECT_CALL(mock, wake()).Times(1);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(subscriber.write(message));
+  }
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  // reader found the queue empty, so next burst wakes again
+  EXPECT_EQ(4u, subscriber.readAll([](const Message& /*message*/) {}));
+  EXPECT_CALL(mock, wake()).Times(1);
+  EXPECT_TRUE(subscriber.write(message));
+  EXPECT_TRUE(subscriber.write(message));
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  // not woken again, as long as reader did not find the queue empty
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_CALL(mock, wake()).Times(0);
+  EXPECT_TRUE(subscriber.write(message));
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_FALSE(subscriber.read(message));
+  EXPECT_CALL(mock, wake()).Times(1);
+  EXPECT_TRUE(subscriber.write(message));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_wake_loop_every_n_messages, if_policy_is_every_n) {
+  LoopMock mock;
+  Subscriber<Message> subscriber("subscriber", 16, &mock);
+  subscriber.setWakePolicy(WakePolicy::EVERY_N, 3);
+
+  Message messages[4];
+  EXPECT_CALL(mock, wake()).Times(3);
+  for (int i = 0; i < 7; ++i) {
+    EXPECT_TRUE(subscriber.write(messages[0]));
+  }
+  EXPECT_EQ(4u, subscriber.write(messages, 4));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_wake_loop_at_watermark, if_policy_is_watermark) {
+  LoopMock mock;
+  Subscriber<Message> subscriber("subscriber", 8, &mock);
+  subscriber.setWakePolicy(WakePolicy::WATERMARK, 3);
+
+  Message message;
+  EXPECT_CALL(mock, wake()).Times(0);
+  EXPECT_TRUE(subscriber.write(message));
+  EXPECT_TRUE(subscriber.write(message));
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_CALL(mock, wake()).Times(1);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(subscriber.write(message));
+  }
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_EQ(6u, subscriber.readAll([](const Message& /*message*/) {}));
+  EXPECT_CALL(mock, wake()).Times(1);
+  for (int i = 0; i < 3; ++i) {
+    EXPECT_TRUE(subscriber.write(message));
+  }
+}
+
+DESCRIBE_F(BASE_SubscriberTest, getStatistics, should_count_writes_drops_and_reads) {
+  Subscriber<Message> subscriber("subscriber", 3);
+
+  Message messages[4];
+  EXPECT_TRUE(subscriber.write(messages[0]));
+  EXPECT_EQ(2u, subscriber.write(messages, 4));
+  EXPECT_FALSE(subscriber.write(messages[0]));
+  EXPECT_TRUE(subscriber.read(messages[0]));
+  EXPECT_EQ(2u, subscriber.read(messages, 4));
+
+  const Statistics statistics = subscriber.getStatistics();
+  EXPECT_EQ(3u, statistics.writes);
+  EXPECT_EQ(3u, statistics.drops);
+  EXPECT_EQ(3u, statistics.reads);
+  EXPECT_EQ(3u, statistics.high_water_mark);
+  // time of last write is only recorded by publishers
+  EXPECT_EQ(std::chrono::steady_clock::time_point(), statistics.last_write);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, getStatistics, should_record_fill_level_found_by_reader) {
+  Subscriber<Message> subscriber("subscriber", 8);
+
+  Message messages[7];
+  EXPECT_EQ(7u, subscriber.write(messages, 7));
+  EXPECT_EQ(7u, subscriber.readAll([](const Message& /*message*/) {}));
+  EXPECT_TRUE(subscriber.write(messages[0]));
+  EXPECT_TRUE(subscriber.read(messages[0]));
+
+  EXPECT_EQ(7u, subscriber.getStatistics().high_water_mark);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, getStatistics, should_count_overwritten_messages_as_drops) {
+  OverwriteSubscriber<Message> subscriber("subscriber", 2);
+
+  Message messages[4];
+  EXPECT_TRUE(subscriber.write(messages[0]));
+  EXPECT_TRUE(subscriber.write(messages[1]));
+  EXPECT_TRUE(subscriber.write(messages[2]));
+  EXPECT_EQ(4u, subscriber.write(messages, 4));
+
+  const Statistics statistics = subscriber.getStatistics();
+  EXPECT_EQ(7u, statistics.writes);
+  EXPECT_EQ(5u, statistics.drops);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, writeFor, should_wait_for_free_space) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  subscriber.setBlockingWrites(true);
+  Message message{'x', true, 1, 0.5f, 0.5};
+  EXPECT_TRUE(subscriber.write(message));
+
+  std::thread reader([&subscriber] {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Message read_message;
+    EXPECT_TRUE(subscriber.read(read_message));
+  });
+
+  const auto start = std::chrono::steady_clock::now();
+  message.count = 2;
+  EXPECT_TRUE(subscriber.writeFor(message, std::chrono::seconds(5)));
+  EXPECT_LE(std::chrono::milliseconds(10), std::chrono::steady_clock::now() - start);
+  reader.join();
+
+  Message read_message;
+  EXPECT_TRUE(subscriber.read(read_message));
+  EXPECT_EQ(message, read_message);
+  EXPECT_EQ(0u, subscriber.getStatistics().drops);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, writeFor, should_return_false, if_timeout_elapsed) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  subscriber.setBlockingWrites(true);
+  Message message;
+  EXPECT_TRUE(subscriber.writeFor(message, std::chrono::milliseconds(0)));
+  EXPECT_FALSE(subscriber.writeFor(message, std::chrono::milliseconds(0)));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(subscriber.writeFor(message, std::chrono::milliseconds(10)));
+  EXPECT_LE(std::chrono::milliseconds(10), std::chrono::steady_clock::now() - start);
+
+  const Statistics statistics = subscriber.getStatistics();
+  EXPECT_EQ(1u, statistics.writes);
+  EXPECT_EQ(2u, statistics.drops);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, writeFor, should_not_wait, if_blocking_writes_are_disabled) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  Message message;
+  EXPECT_TRUE(subscriber.writeFor(message, std::chrono::seconds(5)));
+
+  const auto start = std::chrono::steady_clock::now();
+  EXPECT_FALSE(subscriber.writeFor(message, std::chrono::seconds(5)));
+  EXPECT_GT(std::chrono::seconds(1), std::chrono::steady_clock::now() - start);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, setDecimation, should_check_precondidtions) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  // expect decimation greater than 0
+  EXPECT_THROW(subscriber.setDecimation(0), std::experimental::contract_violation_error);
+  // expect interval not negative
+  EXPECT_THROW(subscriber.setDecimation(1, std::chrono::milliseconds(-1)),
+               std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_queue_every_nth_message, if_decimation_is_set) {
+  LoopMock mock;
+  Subscriber<Message> subscriber("subscriber", 4, &mock);
+  subscriber.setDecimation(3);
+
+  EXPECT_CALL(mock, wake()).Times(3);
+  Message message;
+  for (int count = 0; count < 7; ++count) {
+    message.count = count;
+    EXPECT_TRUE(subscriber.write(message));
+  }
+
+  for (int count : {0, 3, 6}) {
+    EXPECT_TRUE(subscriber.read(message));
+    EXPECT_EQ(count, message.count);
+  }
+  EXPECT_FALSE(subscriber.read(message));
+  EXPECT_EQ(3u, subscriber.getStatistics().writes);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_limit_rate, if_minimal_interval_is_set) {
+  Subscriber<Message> subscriber("subscriber", 4);
+  subscriber.setDecimation(1, std::chrono::milliseconds(20));
+
+  Message message;
+  message.count = 1;
+  EXPECT_TRUE(subscriber.write(message));
+  message.count = 2;
+  EXPECT_TRUE(subscriber.write(message));
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  message.count = 3;
+  EXPECT_TRUE(subscriber.write(message));
+
+  for (int count : {1, 3}) {
+    EXPECT_TRUE(subscriber.read(message));
+    EXPECT_EQ(count, message.count);
+  }
+  EXPECT_FALSE(subscriber.read(message));
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_not_claim_interval, if_queue_is_full) {
+  Subscriber<Message> subscriber("subscriber", 1);
+  subscriber.setDecimation(1, std::chrono::milliseconds(20));
+
+  Message message;
+  message.count = 1;
+  EXPECT_TRUE(subscriber.write(message));
+  std::this_thread::sleep_for(std::chrono::milliseconds(25));
+  // rejected message gives its interval back
+  message.count = 2;
+  EXPECT_FALSE(subscriber.write(message));
+
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(1, message.count);
+  message.count = 3;
+  EXPECT_TRUE(subscriber.write(message));
+  EXPECT_TRUE(subscriber.read(message));
+  EXPECT_EQ(3, message.count);
+}
+
+DESCRIBE_F(BASE_SubscriberTest, write, should_decimate_batch) {
+  Subscriber<Message> subscriber("subscriber", 2);
+  subscriber.setDecimation(2);
+
+  Message messages[5];
+  for (int count = 0; count < 5; ++count) {
+    messages[count].count = count;
+  }
+  // messages 0 and 2 are queued, message 4 doesn't fit anymore
+  EXPECT_EQ(4u, subscriber.write(messages, 5));
+
+  Message read_messages[3];
+  EXPECT_EQ(2u, subscriber.read(read_messages, 3));
+  EXPECT_EQ(0, read_messages[0].count);
+  EXPECT_EQ(2, read_messages[1].count);
+  EXPECT_EQ(1u, subscriber.getStatistics().drops);
+}
+
 }  // namespace fdl::test::subscriber
@@ -11,6 +11,7 @@ class ThreadMock : public IThread {
   ~ThreadMock() override = default;
 
   MOCK_METHOD1(setPeriod, void(std::chrono::microseconds));
+  MOCK_METHOD1(setEventTriggered, void(bool));
   MOCK_METHOD1(setStackSize, void(size_t));
   MOCK_METHOD0(create, void());
   MOCK_METHOD0(cancel, void());
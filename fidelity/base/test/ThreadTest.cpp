@@ -63,6 +63,10 @@ class BASE_ThreadTest : public t::Test {
   void checkPeriod(Thread* thread, std::chrono::microseconds period) {
     EXPECT_EQ(period, thread->m_period);
   }
+
+  void checkEventTriggered(Thread* thread, bool is_event_triggered) {
+    EXPECT_EQ(is_event_triggered, thread->m_is_event_triggered);
+  }
 };
 
 DESCRIBE_F(BASE_ThreadTest, constructor, should_check_preconditions) {
@@ -94,6 +98,17 @@ DESCRIBE_F(BASE_ThreadTest, setPeriod, should_set_thread_period) {
   checkPeriod(thread.get(), period);
 }
 
+DESCRIBE_F(BASE_ThreadTest, setEventTriggered, should_set_event_triggering) {
+  auto system = std::make_shared<SystemAdapterMock>();
+  injectSystemAdapter(system);
+
+  auto thread = createThread("thread", Thread::Type::RT, 1, -1, [] {}, *system);
+  checkEventTriggered(thread.get(), true);
+
+  thread->setEventTriggered(false);
+  checkEventTriggered(thread.get(), false);
+}
+
 DESCRIBE_F(BASE_ThreadTest, setStackSize, should_set_stack_size) {
   auto system = std::make_shared<SystemAdapterMock>();
   injectSystemAdapter(system);
@@ -267,4 +282,95 @@ DESCRIBE_F(BASE_ThreadTest, run, should_call_update_if_thread_is_periodic_and_wo
   EXPECT_TRUE(updated);
 }
 
+DESCRIBE_F(BASE_ThreadTest, run, should_call_update_on_each_wake_of_sleeping_thread) {
+  auto system = std::make_shared<SystemAdapterMock>();
+  injectSystemAdapter(system);
+
+  std::atomic<int> updates{0};
+  auto thread = createThread("non_rt_thread", Thread::Type::NON_RT, 0, -1,
+                             [&updates] { ++updates; }, *system);
+
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setschedpolicy(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setinheritsched(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_create(t::_, t::_, t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_setname_np(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_destroy(t::_));
+
+  thread->create();
+  void* thread_ptr = thread.get();
+  std::future<void> result(std::async([thread_ptr] { Thread::threadRun(thread_ptr); }));
+
+  for (int wake = 1; wake <= 10; ++wake) {
+    // let thread fall asleep, so each wake up needs to wake the sleeping thread
+    std::this_thread::sleep_for(1ms);
+    thread->wake();
+    const auto deadline = std::chrono::steady_clock::now() + 1s;
+    while (updates <= wake && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    EXPECT_EQ(wake + 1, updates);
+  }
+
+  thread->stop();
+  result.wait();
+}
+
+DESCRIBE_F(BASE_ThreadTest, run, should_call_update_periodically_if_thread_is_not_event_triggered) {
+  auto system = std::make_shared<SystemAdapterMock>();
+  injectSystemAdapter(system);
+
+  std::atomic<int> updates{0};
+  auto thread = createThread("non_rt_thread", Thread::Type::NON_RT, 0, -1,
+                             [&updates] { ++updates; }, *system);
+
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setschedpolicy(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setinheritsched(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_create(t::_, t::_, t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_setname_np(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_destroy(t::_));
+
+  thread->setPeriod(1ms);
+  thread->setEventTriggered(false);
+  thread->create();
+  void* thread_ptr = thread.get();
+  std::future<void> result(std::async([thread_ptr] { Thread::threadRun(thread_ptr); }));
+  std::this_thread::sleep_for(20ms);
+
+  thread->stop();
+  result.wait();
+  EXPECT_GT(updates, 1);
+}
+
+DESCRIBE_F(BASE_ThreadTest, stop, should_end_sleep_of_periodic_thread) {
+  auto system = std::make_shared<SystemAdapterMock>();
+  injectSystemAdapter(system);
+
+  std::atomic<int> updates{0};
+  auto thread = createThread("non_rt_thread", Thread::Type::NON_RT, 0, -1,
+                             [&updates] { ++updates; }, *system);
+
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setschedpolicy(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_setinheritsched(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_create(t::_, t::_, t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_setname_np(t::_, t::_));
+  EXPECT_CALL(system->pthreadMock(), pthread_attr_destroy(t::_));
+
+  thread->setPeriod(10s);
+  thread->setEventTriggered(false);
+  thread->create();
+  void* thread_ptr = thread.get();
+  std::future<void> result(std::async([thread_ptr] { Thread::threadRun(thread_ptr); }));
+  std::this_thread::sleep_for(5ms);
+
+  // purely periodic thread ignores wake up
+  thread->wake();
+  std::this_thread::sleep_for(5ms);
+  EXPECT_EQ(1, updates);
+
+  const auto start = std::chrono::steady_clock::now();
+  thread->stop();
+  EXPECT_EQ(std::future_status::ready, result.wait_for(1s));
+  EXPECT_GT(1s, std::chrono::steady_clock::now() - start);
+}
+
 }  // namespace fdl::test::thread
@@ -0,0 +1,102 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <memory>
+#include <string>
+
+#include "Definitions.hpp"
+#include "LoopMock.hpp"
+
+#include "../LatestSubscriber.hpp"
+#include "../TopicRegistry.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::topic_registry {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+class BASE_TopicRegistryTest : public t::Test {
+ protected:
+  TopicRegistry m_registry;
+};
+
+DESCRIBE_F(BASE_TopicRegistryTest, publisher, should_check_precondidtions) {
+  // expect non empty topic
+  EXPECT_THROW(m_registry.publisher<Message>(""), std::experimental::contract_violation_error);
+  // expect matching message type
+  m_registry.publisher<Message>("topic");
+  EXPECT_THROW(m_registry.publisher<int>("topic"), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_TopicRegistryTest, publisher, should_return_same_publisher_for_topic) {
+  EXPECT_FALSE(m_registry.contains("topic"));
+  auto publisher = m_registry.publisher<Message>("topic");
+  ASSERT_NE(nullptr, publisher);
+  EXPECT_EQ("topic", publisher->getName());
+  EXPECT_TRUE(m_registry.contains("topic"));
+
+  EXPECT_EQ(publisher, m_registry.publisher<Message>("topic"));
+  EXPECT_NE(publisher, m_registry.publisher<Message>("other_topic"));
+
+  m_registry.clear();
+  EXPECT_FALSE(m_registry.contains("topic"));
+  EXPECT_NE(publisher, m_registry.publisher<Message>("topic"));
+}
+
+DESCRIBE_F(BASE_TopicRegistryTest, subscriber, should_receive_messages_of_topic) {
+  // subscriber can be declared before publisher
+  auto subscriber = m_registry.subscriber<Message>("topic", "subscriber", 2);
+  auto latest_subscriber =
+      m_registry.subscriber<Message, LatestSubscriber<Message>>("topic", "latest_subscriber");
+  ASSERT_NE(nullptr, subscriber);
+  ASSERT_NE(nullptr, latest_subscriber);
+  EXPECT_EQ(nullptr, m_registry.subscriber<Message>("topic", "subscriber", 2));
+
+  auto publisher = m_registry.publisher<Message>("topic");
+  EXPECT_TRUE(publisher->write({1, 0.5}));
+
+  Message message;
+  EXPECT_TRUE(subscriber->read(message));
+  EXPECT_EQ(1, message.count);
+  EXPECT_TRUE(latest_subscriber->read(message));
+  EXPECT_EQ(1, message.count);
+}
+
+DESCRIBE_F(BASE_TopicRegistryTest, instance, should_return_process_wide_registry) {
+  EXPECT_EQ(&TopicRegistry::instance(), &TopicRegistry::instance());
+}
+
+DESCRIBE_F(BASE_TopicRegistryTest, directSubscriber, should_be_created, if_loop_publishes_topic) {
+  LoopMock loop;
+  LoopMock other_loop;
+  int count = 0;
+  auto callback = [&count](const Message& message) { count += message.count; };
+
+  // publisher not declared with owner yet
+  EXPECT_EQ(nullptr, m_registry.directSubscriber<Message>("topic", "direct", &loop, callback));
+
+  auto publisher = m_registry.publisher<Message>("topic", &loop);
+  EXPECT_TRUE(m_registry.isPublishedBy("topic", &loop));
+  EXPECT_FALSE(m_registry.isPublishedBy("topic", &other_loop));
+  EXPECT_EQ(publisher, m_registry.publisher<Message>("topic"));
+  EXPECT_THROW(m_registry.publisher<Message>("topic", &other_loop),
+               std::experimental::contract_violation_error);
+
+  EXPECT_EQ(nullptr,
+            m_registry.directSubscriber<Message>("topic", "direct", &other_loop, callback));
+  auto subscriber = m_registry.directSubscriber<Message>("topic", "direct", &loop, callback);
+  ASSERT_NE(nullptr, subscriber);
+  EXPECT_EQ(nullptr, m_registry.directSubscriber<Message>("topic", "direct", &loop, callback));
+
+  EXPECT_TRUE(publisher->write({3, 0.5}));
+  EXPECT_EQ(3, count);
+}
+
+}  // namespace fdl::test::topic_registry
@@ -0,0 +1,66 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <contract/contract_assert.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include "Definitions.hpp"
+#include "LoopMock.hpp"
+
+#include "../Subscriber.hpp"
+#include "../WaitSet.hpp"
+
+namespace t = testing;
+
+namespace fdl::test::wait_set {
+
+class BASE_WaitSetTest : public t::Test {};
+
+DESCRIBE_F(BASE_WaitSetTest, constructor, should_check_precondidtions) {
+  // expect loop
+  EXPECT_THROW(WaitSet(nullptr), std::experimental::contract_violation_error);
+  // expect index less than capacity
+  LoopMock mock;
+  WaitSet wait_set(&mock);
+  EXPECT_THROW(wait_set.trigger(WaitSet::CAPACITY), std::experimental::contract_violation_error);
+}
+
+DESCRIBE_F(BASE_WaitSetTest, trigger, should_mark_input_ready_and_wake_loop_once) {
+  LoopMock mock;
+  WaitSet wait_set(&mock);
+
+  EXPECT_CALL(mock, wake()).Times(1);
+  wait_set.trigger(3)->wake();
+  wait_set.trigger(63)->wake();
+  wait_set.trigger(3)->wake();
+  t::Mock::VerifyAndClearExpectations(&mock);
+
+  EXPECT_EQ((uint64_t{1} << 3) | (uint64_t{1} << 63), wait_set.takeReady());
+  EXPECT_EQ(0u, wait_set.takeReady());
+
+  // loop is woken up again after ready inputs were taken
+  EXPECT_CALL(mock, wake()).Times(1);
+  wait_set.trigger(0)->wake();
+  EXPECT_EQ(1u, wait_set.takeReady());
+}
+
+DESCRIBE_F(BASE_WaitSetTest, forEachReady, should_call_functor_for_ready_subscribers) {
+  LoopMock mock;
+  WaitSet wait_set(&mock);
+  Subscriber<int> subscriber_0("subscriber_0", 2, wait_set.trigger(0));
+  Subscriber<int> subscriber_1("subscriber_1", 2, wait_set.trigger(1));
+  Subscriber<int> subscriber_2("subscriber_2", 2, wait_set.trigger(2));
+
+  EXPECT_CALL(mock, wake()).Times(1);
+  EXPECT_TRUE(subscriber_2.write(2));
+  EXPECT_TRUE(subscriber_0.write(0));
+
+  std::vector<size_t> ready;
+  EXPECT_EQ(2u, wait_set.forEachReady([&ready](size_t index) { ready.push_back(index); }));
+  EXPECT_EQ(std::vector<size_t>({0, 2}), ready);
+  EXPECT_EQ(0u, wait_set.forEachReady([](size_t /*index*/) { FAIL(); }));
+}
+
+}  // namespace fdl::test::wait_set
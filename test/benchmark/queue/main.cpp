@@ -0,0 +1,219 @@
+#include <fidelity/base/Copy.hpp>
+#include <fidelity/base/SpscQueue.hpp>
+#include <fidelity/base/Subscriber.hpp>
+
+#include <boost/lockfree/spsc_queue.hpp>
+
+#include <contract/contract_assert.hpp>
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <experimental/filesystem>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace fs = std::experimental::filesystem;
+
+void throw_on_contract_violation(const std::experimental::contract_violation_info& info) {
+  throw std::experimental::contract_violation_error(info);
+}
+
+void usage(const std::string& cmd) {
+  std::cout << "Single producer single consumer queue benchmark" << std::endl;
+  std::cout << "Usage: " << fs::path(cmd).filename().c_str() << " <messages>" << std::endl;
+}
+
+/** Subscriber with queue interface, measures the path taken by publishers and readers. */
+template <typename QueueT, bool BlockingWrites = false>
+class SubscriberQueue {
+ public:
+  explicit SubscriberQueue(size_t capacity) : m_subscriber("benchmark", capacity) {
+    m_subscriber.setBlockingWrites(BlockingWrites);
+  }
+
+  bool push(uint64_t message) {
+    return m_subscriber.write(message);
+  }
+
+  bool pop(uint64_t& message) {
+    return m_subscriber.read(message);
+  }
+
+ private:
+  fdl::Subscriber<uint64_t, QueueT> m_subscriber;
+};
+
+/** Pin calling thread to cpu, if the system has enough cpus. */
+void pin(unsigned int cpu) {
+  if (cpu >= std::thread::hardware_concurrency()) {
+    return;
+  }
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  CPU_SET(cpu, &cpu_set);
+  pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+}
+
+/** Wait for the other side, yield only if both sides share a cpu. */
+void idle() {
+  static const bool shared_cpu = std::thread::hardware_concurrency() < 2;
+  if (shared_cpu) {
+    std::this_thread::yield();
+  }
+}
+
+/** Measure messages per second from a producer to a consumer on another cpu. */
+template <typename QueueT>
+double throughput(uint64_t messages) {
+  QueueT queue(1024);
+
+  std::thread consumer([&queue, messages] {
+    pin(1);
+    uint64_t message = 0;
+    for (uint64_t expected = 0; expected < messages;) {
+      if (queue.pop(message)) {
+        if (message != expected) {
+          std::cerr << "unexpected message " << message << std::endl;
+        }
+        ++expected;
+      } else {
+        idle();
+      }
+    }
+  });
+
+  pin(0);
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t message = 0; message < messages;) {
+    if (queue.push(message)) {
+      ++message;
+    } else {
+      idle();
+    }
+  }
+  consumer.join();
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(messages) / duration.count();
+}
+
+/** Measure mean round trip time in ns of a message sent back and forth between two cpus. */
+template <typename QueueT>
+double roundTrip(uint64_t messages) {
+  QueueT ping(1024);
+  QueueT pong(1024);
+
+  std::thread echo([&ping, &pong, messages] {
+    pin(1);
+    uint64_t message = 0;
+    for (uint64_t count = 0; count < messages;) {
+      if (ping.pop(message)) {
+        while (!pong.push(message)) {
+          idle();
+        }
+        ++count;
+      } else {
+        idle();
+      }
+    }
+  });
+
+  pin(0);
+  const auto start = std::chrono::steady_clock::now();
+  uint64_t message = 0;
+  for (uint64_t count = 0; count < messages; ++count) {
+    while (!ping.push(count)) {
+      idle();
+    }
+    while (!pong.pop(message)) {
+      idle();
+    }
+  }
+  echo.join();
+  const std::chrono::duration<double, std::nano> duration =
+      std::chrono::steady_clock::now() - start;
+  return duration.count() / static_cast<double>(messages);
+}
+
+/** Measure copied GiB per second of a frame, copied round robin into the slots of a queue. */
+template <void (*Copy)(void*, const void*, size_t)>
+double copyRate(size_t size, uint64_t copies) {
+  constexpr size_t slots = 16;
+  std::vector<char> source(size, 1);
+  std::vector<char> queue(size * slots);
+  const auto start = std::chrono::steady_clock::now();
+  for (uint64_t copy = 0; copy < copies; ++copy) {
+    source[copy % size] = static_cast<char>(copy);
+    Copy(&queue[(copy % slots) * size], source.data(), size);
+  }
+  const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+  if (queue[((copies - 1) % slots) * size + (copies - 1) % size] !=
+      static_cast<char>(copies - 1)) {
+    std::cerr << "unexpected copy" << std::endl;
+  }
+  return static_cast<double>(size * copies) / duration.count() / (1024.0 * 1024.0 * 1024.0);
+}
+
+void memoryCopy(void* destination, const void* source, size_t size) {
+  std::memcpy(destination, source, size);
+}
+
+void runCopy(size_t size, uint64_t messages) {
+  // copy the same amount of bytes as 1000 messages of 64 KiB for each size
+  const uint64_t copies = messages / 1000 * 65536 / size + 1;
+  const std::string name = std::to_string(size / 1024) + " KiB";
+  std::cout << std::setw(28) << std::left << "std::memcpy " + name << std::setw(16) << std::right
+            << std::fixed << std::setprecision(2) << copyRate<memoryCopy>(size, copies)
+            << " GiB/s" << std::endl;
+  std::cout << std::setw(28) << std::left << "fdl::copy::copy " + name << std::setw(16)
+            << std::right << std::fixed << std::setprecision(2)
+            << copyRate<fdl::copy::copy>(size, copies) << " GiB/s" << std::endl;
+  fdl::copy::setNonTemporalSize(size);
+  std::cout << std::setw(28) << std::left << "fdl::copy::copy (nt) " + name << std::setw(16)
+            << std::right << std::fixed << std::setprecision(2)
+            << copyRate<fdl::copy::copy>(size, copies) << " GiB/s" << std::endl;
+  fdl::copy::setNonTemporalSize(0);
+}
+
+template <typename QueueT>
+void run(const std::string& name, uint64_t messages) {
+  std::cout << std::setw(28) << std::left << name << std::setw(16) << std::right << std::fixed
+            << std::setprecision(0) << throughput<QueueT>(messages) << " msg/s" << std::setw(12)
+            << std::setprecision(1) << roundTrip<QueueT>(messages / 100) << " ns round trip"
+            << std::endl;
+}
+
+int main(int argc, char* argv[]) {
+  std::experimental::set_handle_contract_violation(throw_on_contract_violation);
+  std::string command = argv[0];  // NOLINT
+  if (argc <= 1) {
+    usage(command);
+    return 0;
+  }
+
+  const long long messages = std::stoll(argv[1], nullptr);  // NOLINT
+  if (messages < 100) {
+    usage(command);
+    return 1;
+  }
+
+  if (std::thread::hardware_concurrency() < 2) {
+    std::cout << "Only one cpu available, producer and consumer share it." << std::endl;
+  }
+
+  run<boost::lockfree::spsc_queue<uint64_t>>("boost::lockfree::spsc_queue", messages);
+  run<fdl::SpscQueue<uint64_t>>("fdl::SpscQueue", messages);
+  run<SubscriberQueue<boost::lockfree::spsc_queue<uint64_t>>>("fdl::Subscriber (boost)", messages);
+  run<SubscriberQueue<fdl::SpscQueue<uint64_t>>>("fdl::Subscriber (SpscQueue)", messages);
+  run<SubscriberQueue<fdl::SpscQueue<uint64_t>, true>>("fdl::Subscriber (blocking)", messages);
+  for (const size_t size : {4096, 65536, 1048576}) {
+    runCopy(size, messages);
+  }
+  return 0;
+}
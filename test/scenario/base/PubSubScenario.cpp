@@ -2,13 +2,19 @@
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <array>
 #include <memory>
+#include <string>
 #include <thread>
 
 #include <fidelity/base/test/Definitions.hpp>
 
+#include <fidelity/base/LatestSubscriber.hpp>
 #include <fidelity/base/Publisher.hpp>
+#include <fidelity/base/SamplePool.hpp>
 #include <fidelity/base/Subscriber.hpp>
+#include <fidelity/base/TopicRegistry.hpp>
+#include <fidelity/base/WaitSet.hpp>
 #include <fidelity/base/Loop.hpp>
 
 using namespace std::chrono_literals;
@@ -71,6 +77,36 @@ DESCRIBE(BASE_PubSubScenario, all_subscribers, should_receive_published_messages
   EXPECT_EQ(message, read_message);
 }
 
+DESCRIBE(BASE_PubSubScenario, loaned_samples, should_be_received_without_copy) {
+  SamplePool<Message> pool(2);
+  Publisher<Sample<Message>> publisher("publisher");
+  auto subscriber_1 = std::make_shared<Subscriber<Sample<Message>>>("subscriber_1", 1);
+  auto subscriber_2 = std::make_shared<Subscriber<Sample<Message>>>("subscriber_2", 1);
+
+  EXPECT_TRUE(publisher.subscribe(subscriber_1));
+  EXPECT_TRUE(publisher.subscribe(subscriber_2));
+
+  {
+    auto sample = pool.loan();
+    ASSERT_TRUE(sample);
+    *sample = {'x', false, 1, 0.5f, 0.5};
+    EXPECT_TRUE(publisher.write(sample));
+  }
+
+  Sample<Message> read_sample_1;
+  Sample<Message> read_sample_2;
+  EXPECT_TRUE(subscriber_1->read(read_sample_1));
+  EXPECT_TRUE(subscriber_2->read(read_sample_2));
+  EXPECT_EQ(&*read_sample_1, &*read_sample_2);
+  EXPECT_EQ(Message({'x', false, 1, 0.5f, 0.5}), *read_sample_1);
+
+  // slot is returned after all readers released the sample
+  EXPECT_EQ(1u, pool.available());
+  read_sample_1 = Sample<Message>();
+  read_sample_2 = Sample<Message>();
+  EXPECT_EQ(2u, pool.available());
+}
+
 // std::atomic<bool> send_done{false};
 // std::atomic<bool> receive_done{false};
 //
@@ -162,4 +198,267 @@ DESCRIBE(BASE_PubSubScenario, publishing_and_receiving_messages, should_execute)
   receiver.stop();
 }
 
+class StateReceiver : public RTLoop {
+ public:
+  StateReceiver() : RTLoop("state_receiver") {}
+
+  std::shared_ptr<LatestSubscriber<Message>> getSubscriber() const {
+    return m_subscriber;
+  }
+
+  int getCount() const {
+    return m_count;
+  }
+
+  Message getMessage() const {
+    return m_message;
+  }
+
+  void onRun() override {
+    if (m_subscriber->read(m_message)) {
+      m_count++;
+    }
+  }
+
+ private:
+  std::shared_ptr<LatestSubscriber<Message>> m_subscriber{
+      std::make_shared<LatestSubscriber<Message>>("subscriber")};
+
+  int m_count{0};
+  Message m_message{};
+};
+
+DESCRIBE(BASE_PubSubScenario, publishing_and_receiving_states, should_execute) {
+  Sender sender({'x', false, 1, 0.5f, 0.5});
+  StateReceiver receiver;
+
+  auto publisher = sender.getPublisher();
+  auto subscriber = receiver.getSubscriber();
+  EXPECT_TRUE(publisher->subscribe(subscriber));
+
+  EXPECT_TRUE(sender.configure());
+  EXPECT_TRUE(sender.start());
+  EXPECT_TRUE(receiver.configure());
+  EXPECT_TRUE(receiver.start());
+
+  for (int i = 0; i < 10; i++) {
+    sender.wake();
+    std::this_thread::sleep_for(1ms);
+    receiver.wake();
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(11, sender.getCount());
+  EXPECT_LE(1, receiver.getCount());
+  EXPECT_GE(sender.getCount(), receiver.getCount());
+  EXPECT_EQ(sender.getMessage(), receiver.getMessage());
+
+  sender.stop();
+  receiver.stop();
+}
+
+class TopicSender : public RTLoop {
+ public:
+  TopicSender() : RTLoop("topic_sender") {}
+
+  int getCount() const {
+    return m_count;
+  }
+
+  bool onConfigure() override {
+    m_publisher = TopicRegistry::instance().publisher<Message>("scenario/messages");
+    return m_publisher != nullptr;
+  }
+
+  void onRun() override {
+    m_publisher->write({'t', true, m_count, 0.5f, 0.5});
+    m_count++;
+  }
+
+ private:
+  std::shared_ptr<Publisher<Message>> m_publisher{};
+
+  int m_count{0};
+};
+
+class TopicReceiver : public RTLoop {
+ public:
+  TopicReceiver() : RTLoop("topic_receiver") {}
+
+  int getCount() const {
+    return m_count;
+  }
+
+  bool onConfigure() override {
+    m_subscriber = TopicRegistry::instance().subscriber<Message>("scenario/messages",
+                                                                 "topic_receiver", 2, this);
+    return m_subscriber != nullptr;
+  }
+
+  void onRun() override {
+    Message message;
+    while (m_subscriber->read(message)) {
+      m_count++;
+    };
+  }
+
+ private:
+  std::shared_ptr<Subscriber<Message>> m_subscriber{};
+
+  int m_count{0};
+};
+
+DESCRIBE(BASE_PubSubScenario, wiring_by_topic_name, should_execute) {
+  TopicReceiver receiver;
+  TopicSender sender;
+
+  // receiver declares topic before sender
+  EXPECT_TRUE(receiver.configure());
+  EXPECT_TRUE(sender.configure());
+  EXPECT_TRUE(receiver.start());
+  EXPECT_TRUE(sender.start());
+
+  for (int i = 0; i < 10; i++) {
+    sender.wake();
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(11, sender.getCount());
+  EXPECT_EQ(sender.getCount(), receiver.getCount());
+
+  sender.stop();
+  receiver.stop();
+  TopicRegistry::instance().clear();
+}
+
+class MultiReceiver : public RTLoop {
+ public:
+  static constexpr size_t INPUTS = 8;
+
+  MultiReceiver() : RTLoop("multi_receiver") {
+    for (size_t index = 0; index < INPUTS; ++index) {
+      m_subscribers[index] = std::make_shared<Subscriber<Message>>(
+          "subscriber_" + std::to_string(index), 4, m_wait_set.trigger(index));
+    }
+  }
+
+  std::shared_ptr<Subscriber<Message>> getSubscriber(size_t index) const {
+    return m_subscribers[index];
+  }
+
+  int getCount(size_t index) const {
+    return m_counts[index];
+  }
+
+  void onRun() override {
+    // only subscribers which received data are read
+    m_wait_set.forEachReady([this](size_t index) {
+      Message message;
+      while (m_subscribers[index]->read(message)) {
+        m_counts[index]++;
+      }
+    });
+  }
+
+ private:
+  WaitSet m_wait_set{this};
+
+  std::array<std::shared_ptr<Subscriber<Message>>, INPUTS> m_subscribers{};
+
+  std::array<int, INPUTS> m_counts{};
+};
+
+DESCRIBE(BASE_PubSubScenario, receiving_from_many_publishers, should_execute) {
+  MultiReceiver receiver;
+  Publisher<Message> publisher_1("publisher_1");
+  Publisher<Message> publisher_5("publisher_5");
+  EXPECT_TRUE(publisher_1.subscribe(receiver.getSubscriber(1)));
+  EXPECT_TRUE(publisher_5.subscribe(receiver.getSubscriber(5)));
+
+  EXPECT_TRUE(receiver.configure());
+  EXPECT_TRUE(receiver.start());
+
+  for (int i = 0; i < 10; i++) {
+    EXPECT_TRUE(publisher_1.write({'a', true, i, 0.5f, 0.5}));
+    if (i % 2 == 0) {
+      EXPECT_TRUE(publisher_5.write({'b', true, i, 0.5f, 0.5}));
+    }
+    std::this_thread::sleep_for(1ms);
+  }
+
+  EXPECT_EQ(10, receiver.getCount(1));
+  EXPECT_EQ(5, receiver.getCount(5));
+  EXPECT_EQ(0, receiver.getCount(0));
+
+  receiver.stop();
+}
+
+class Pipeline : public RTLoop {
+ public:
+  static constexpr int MESSAGES = 10;
+
+  Pipeline() : RTLoop("pipeline") {}
+
+  int getCount() const {
+    return m_count;
+  }
+
+  int getQueuedCount() const {
+    return m_queued_count;
+  }
+
+  bool onConfigure() override {
+    auto& registry = TopicRegistry::instance();
+    m_publisher = registry.publisher<Message>("scenario/pipeline", this);
+    // second stage runs in the same loop, so it is called directly by the publisher
+    auto stage = registry.directSubscriber<Message>("scenario/pipeline", "pipeline_stage", this,
+                                                    [this](const Message& /*message*/) {
+                                                      m_count++;
+                                                    });
+    // queued subscriber of own loop, wakes the loop without signaling the thread
+    m_subscriber = std::make_shared<Subscriber<Message>>("pipeline_queue", 2, this);
+    return stage != nullptr && m_publisher->subscribe(m_subscriber);
+  }
+
+  void onRun() override {
+    Message message;
+    while (m_subscriber->read(message)) {
+      m_queued_count++;
+    }
+    if (m_written < MESSAGES) {
+      m_publisher->write({'p', true, m_written++, 0.5f, 0.5});
+    }
+  }
+
+ private:
+  std::shared_ptr<Publisher<Message>> m_publisher{};
+
+  std::shared_ptr<Subscriber<Message>> m_subscriber{};
+
+  int m_written{0};
+
+  int m_count{0};
+
+  int m_queued_count{0};
+};
+
+DESCRIBE(BASE_PubSubScenario, publishing_within_one_loop, should_execute) {
+  Pipeline pipeline;
+  EXPECT_TRUE(pipeline.configure());
+
+  // other loops can't subscribe directly
+  TopicReceiver receiver;
+  EXPECT_EQ(nullptr, TopicRegistry::instance().directSubscriber<Message>(
+                         "scenario/pipeline", "other", &receiver, [](const Message&) {}));
+
+  EXPECT_TRUE(pipeline.start());
+  std::this_thread::sleep_for(10ms);
+
+  EXPECT_EQ(Pipeline::MESSAGES, pipeline.getCount());
+  EXPECT_EQ(Pipeline::MESSAGES, pipeline.getQueuedCount());
+
+  pipeline.stop();
+  TopicRegistry::instance().clear();
+}
+
 }  // namespace fdl::test::pubsub_scenario
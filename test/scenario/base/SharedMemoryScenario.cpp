@@ -0,0 +1,67 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+#include <fidelity/base/test/Definitions.hpp>
+
+#include <fidelity/base/Publisher.hpp>
+#include <fidelity/base/SharedMemoryTopic.hpp>
+
+using namespace std::chrono_literals;
+
+namespace fdl::test::shared_memory_scenario {
+
+// pubsub message type
+struct Message {
+  int count{0};
+  double value{0.0};
+};
+
+DESCRIBE(BASE_SharedMemoryScenario, receiver_process, should_receive_published_messages) {
+  constexpr int count = 10000;
+  const std::string name = "/fidelity_scenario_" + std::to_string(getpid());
+
+  Publisher<Message> publisher("publisher");
+  auto sender = std::make_shared<SharedMemorySender<Message>>(name, 64);
+  ASSERT_TRUE(sender->open());
+  ASSERT_TRUE(publisher.subscribe(sender));
+
+  const pid_t child = fork();
+  ASSERT_NE(-1, child);
+  if (child == 0) {
+    // receiver process exits with number of errors
+    SharedMemoryReceiver<Message> receiver(name, 64);
+    int errors = receiver.open() ? 0 : 1;
+    Message message;
+    for (int expected = 0; expected < count && errors == 0;) {
+      if (receiver.read(message)) {
+        errors += message.count != expected++;
+      } else if (!receiver.wait(10s)) {
+        ++errors;
+      }
+    }
+    _exit(errors);
+  }
+
+  for (int i = 0; i < count;) {
+    if (publisher.write(Message{i, 0.5})) {
+      ++i;
+    } else {
+      std::this_thread::yield();
+    }
+  }
+
+  int status = -1;
+  ASSERT_EQ(child, waitpid(child, &status, 0));
+  EXPECT_TRUE(WIFEXITED(status));
+  EXPECT_EQ(0, WEXITSTATUS(status));
+}
+
+}  // namespace fdl::test::shared_memory_scenario